@@ -5,6 +5,7 @@
  */
 
 #include "EtRobocon2023.h"
+#include "SonarSampler.h"
 #include "app.h"
 
 // メインタスク
@@ -13,3 +14,10 @@ void main_task(intptr_t unused)
   EtRobocon2023::start();
   ext_tsk();
 }
+
+// 超音波センサの計測タスク
+void sonar_task(intptr_t unused)
+{
+  SonarSampler::sample();
+  ext_tsk();
+}
@@ -11,14 +11,18 @@ extern "C" {
 #include "ev3api.h"
 
 #define MAIN_PRIORITY TMIN_APP_TPRI + 1
+#define SONAR_PRIORITY TMIN_APP_TPRI + 2
+
+#define SONAR_PERIOD (50 * 1000)  // 超音波センサの計測周期[us](SonarSampler::SAMPLE_PERIODと同じ)
 
 #ifndef STACK_SIZE
 #define STACK_SIZE 4096
 #endif /* STACK_SIZE */
 
 #ifndef TOPPERS_MACRO_ONLY
-extern void main_task(intptr_t exinf);  // メインタスク
-#endif                                  /* TOPPERS_MACRO_ONLY */
+extern void main_task(intptr_t exinf);   // メインタスク
+extern void sonar_task(intptr_t exinf);  // 超音波センサの計測タスク
+#endif                                   /* TOPPERS_MACRO_ONLY */
 
 #ifdef __cplusplus
 }
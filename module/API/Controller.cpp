@@ -4,6 +4,7 @@
  * @author aridome222 miyahita64 bizyutyu
  */
 #include "Controller.h"
+#include "Measurer.h"
 
 ev3api::Motor* Controller::rightMotor = nullptr;
 ev3api::Motor* Controller::leftMotor = nullptr;
@@ -12,6 +13,10 @@ ev3api::Motor* Controller::armMotor = nullptr;
 double Controller::manageRightPwm = 0.0;
 double Controller::manageLeftPwm = 0.0;
 double Controller::manageArmPwm = 0.0;
+// 電圧補正の初期化
+bool Controller::isVoltageCompensationEnabled = false;
+double Controller::filteredVoltage = 0.0;
+double Controller::compensationRatio = 1.0;
 
 int Controller::limitPwmValue(const int value)
 {
@@ -27,14 +32,14 @@ int Controller::limitPwmValue(const int value)
 void Controller::setRightMotorPwm(const double pwm)
 {
   manageRightPwm = pwm;
-  rightMotor->setPWM(limitPwmValue(int(pwm)));
+  rightMotor->setPWM(limitPwmValue(int(pwm * compensationRatio)));
 }
 
 // 左モータにPWM値をセット
 void Controller::setLeftMotorPwm(const double pwm)
 {
   manageLeftPwm = pwm;
-  leftMotor->setPWM(limitPwmValue(int(pwm)));
+  leftMotor->setPWM(limitPwmValue(int(pwm * compensationRatio)));
 }
 
 // タイヤのモータを停止する
@@ -50,7 +55,7 @@ void Controller::stopMotor()
 void Controller::setArmMotorPwm(const double pwm)
 {
   manageArmPwm = pwm;
-  armMotor->setPWM(limitPwmValue(int(pwm)));
+  armMotor->setPWM(limitPwmValue(int(pwm * compensationRatio)));
 }
 
 // アームのモータを停止する
@@ -70,4 +75,64 @@ double Controller::getRightPwm()
 double Controller::getLeftPwm()
 {
   return manageLeftPwm;
-}
\ No newline at end of file
+}
+
+// 電圧補正の有効/無効を切り替える
+void Controller::setVoltageCompensation(bool _isEnabled)
+{
+  isVoltageCompensationEnabled = _isEnabled;
+  if(!isVoltageCompensationEnabled) {
+    compensationRatio = 1.0;
+  }
+}
+
+// 電圧補正が有効かどうかを取得する
+bool Controller::getIsVoltageCompensationEnabled()
+{
+  return isVoltageCompensationEnabled;
+}
+
+// バッテリー電圧を測定し、補正比率を更新する
+void Controller::updateVoltage()
+{
+  // 補正が無効の場合は電圧を測定しない
+  if(!isVoltageCompensationEnabled) return;
+  updateVoltage(Measurer::getVoltage());
+}
+
+// 測定した電圧で補正比率を更新する
+void Controller::updateVoltage(const double voltage)
+{
+  // 不正な測定値は無視する
+  if(voltage <= 0.0) return;
+
+  // 初回は測定値で初期化し、以降はローパスフィルタで平滑化する
+  if(filteredVoltage <= 0.0) {
+    filteredVoltage = voltage;
+  } else {
+    filteredVoltage += VOLTAGE_FILTER_ALPHA * (voltage - filteredVoltage);
+  }
+
+  if(!isVoltageCompensationEnabled) return;
+
+  // 電圧が下がるほどPWM値を大きくする(補正しすぎないよう上下限を設ける)
+  double ratio = NOMINAL_VOLTAGE / filteredVoltage;
+  if(ratio > MAX_COMPENSATION_RATIO) {
+    ratio = MAX_COMPENSATION_RATIO;
+  } else if(ratio < MIN_COMPENSATION_RATIO) {
+    ratio = MIN_COMPENSATION_RATIO;
+  }
+  compensationRatio = ratio;
+}
+
+// 電圧の推定値を取得する
+double Controller::getFilteredVoltage()
+{
+  return filteredVoltage;
+}
+
+// PWM値の補正比率を取得する
+double Controller::getVoltageCompensationRatio()
+{
+  return compensationRatio;
+}
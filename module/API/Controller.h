@@ -52,12 +52,57 @@ class Controller {
    */
   static double getLeftPwm();
 
- private:
+  /**
+   * @brief 電圧補正の有効/無効を切り替える
+   * @param _isEnabled true:PWM値を電圧で補正する, false:補正しない
+   * @note 無効にすると補正比率は1.0に戻る
+   */
+  static void setVoltageCompensation(bool _isEnabled);
+
+  /**
+   * @brief 電圧補正が有効かどうかを取得する
+   * @return true:補正する, false:補正しない
+   */
+  static bool getIsVoltageCompensationEnabled();
+
+  /**
+   * @brief バッテリー電圧を測定し、電圧の推定値と補正比率を更新する
+   * @note 制御ループの外（動作の切り替え時など）で呼び出す。電圧補正が無効の場合は何もしない
+   */
+  static void updateVoltage();
+
+  /**
+   * @brief 測定した電圧で、電圧の推定値と補正比率を更新する
+   * @param voltage 測定した電圧[V]
+   */
+  static void updateVoltage(const double voltage);
+
+  /**
+   * @brief 電圧の推定値を取得する
+   * @return 平滑化した電圧[V](未測定の場合は0.0)
+   */
+  static double getFilteredVoltage();
+
+  /**
+   * @brief PWM値の補正比率を取得する
+   * @return 基準電圧/電圧の推定値(電圧補正が無効の場合は1.0)
+   */
+  static double getVoltageCompensationRatio();
+
+  static constexpr double NOMINAL_VOLTAGE = 7.3;  // 補正の基準電圧[V](SPIKEの電圧の標準値)
   static const int MOTOR_PWM_MAX = 100;
   static const int MOTOR_PWM_MIN = -100;
+
+ private:
   static double manageRightPwm;  // 右タイヤPWM
   static double manageLeftPwm;   // 左タイヤPWM
   static double manageArmPwm;    // アームPWM
+  static constexpr double VOLTAGE_FILTER_ALPHA = 0.2;  // 電圧の平滑化係数
+  static constexpr double MIN_COMPENSATION_RATIO = 0.8;  // 補正比率の下限
+  static constexpr double MAX_COMPENSATION_RATIO = 1.3;  // 補正比率の上限
+  static bool isVoltageCompensationEnabled;  // true:PWM値を電圧で補正する, false:補正しない
+  static double filteredVoltage;             // 平滑化した電圧[V]
+  static double compensationRatio;           // PWM値の補正比率
 
   /**
    * モータに設定するPWM値の制限
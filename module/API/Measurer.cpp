@@ -11,6 +11,11 @@ ev3api::SonarSensor* Measurer::sonarSensor = nullptr;
 ev3api::Motor* Measurer::rightMotor = nullptr;
 ev3api::Motor* Measurer::leftMotor = nullptr;
 ev3api::Motor* Measurer::armMotor = nullptr;
+rgb_raw_t Measurer::lastRawColor = { 0, 0, 0 };
+int Measurer::lastRightCount = 0;
+int Measurer::lastLeftCount = 0;
+int Measurer::rightCountOffset = 0;
+int Measurer::leftCountOffset = 0;
 
 // 明るさを取得
 // 参考: https://tomari.org/main/java/color/ccal.html
@@ -28,31 +33,40 @@ rgb_raw_t Measurer::getRawColor()
 {
   rgb_raw_t rgb;
   colorSensor->getRawColor(rgb);
+  lastRawColor = rgb;
   return rgb;
 }
 
 // 左モータ角位置取得
 int Measurer::getLeftCount()
 {
-  return leftMotor->getCount();
+  lastLeftCount = leftMotor->getCount();
+  return lastLeftCount;
 }
 
 // 左モータ角位置更新
 void Measurer::setLeftCount(int count)
 {
+  // 更新で失われる角位置を起動時からの角位置として保持する
+  leftCountOffset += leftMotor->getCount() - count;
   leftMotor->setCount(count);
+  lastLeftCount = count;
 }
 
 // 右モータ角位置取得
 int Measurer::getRightCount()
 {
-  return rightMotor->getCount();
+  lastRightCount = rightMotor->getCount();
+  return lastRightCount;
 }
 
 // 右モータ角位置更新
 void Measurer::setRightCount(int count)
 {
+  // 更新で失われる角位置を起動時からの角位置として保持する
+  rightCountOffset += rightMotor->getCount() - count;
   rightMotor->setCount(count);
+  lastRightCount = count;
 }
 
 // 左右モータ角位置の初期化
@@ -113,4 +127,46 @@ int Measurer::getForwardDistance()
 double Measurer::getVoltage()
 {
   return (double)ev3_battery_voltage_mV() / 1000.0;
+}
+
+// 直近に取得したRGB値を取得
+rgb_raw_t Measurer::getLastRawColor()
+{
+  return lastRawColor;
+}
+
+// 直近に取得した右モータ角位置を取得
+int Measurer::getLastRightCount()
+{
+  return lastRightCount;
+}
+
+// 直近に取得した左モータ角位置を取得
+int Measurer::getLastLeftCount()
+{
+  return lastLeftCount;
+}
+
+// 直近に取得した起動時からの右モータ角位置を取得
+int Measurer::getLastRightTotalCount()
+{
+  return lastRightCount + rightCountOffset;
+}
+
+// 直近に取得した起動時からの左モータ角位置を取得
+int Measurer::getLastLeftTotalCount()
+{
+  return lastLeftCount + leftCountOffset;
+}
+
+// 起動時からの右モータ角位置を取得
+int Measurer::getRightTotalCount()
+{
+  return getRightCount() + rightCountOffset;
+}
+
+// 起動時からの左モータ角位置を取得
+int Measurer::getLeftTotalCount()
+{
+  return getLeftCount() + leftCountOffset;
 }
\ No newline at end of file
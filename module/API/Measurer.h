@@ -110,6 +110,55 @@ class Measurer {
    * @return SPIKEの電圧[V]
    */
   static double getVoltage();
+
+  /**
+   * 直近に取得したRGB値を取得（センサへの再問い合わせはしない）
+   * @return 直近に取得したRGB値
+   */
+  static rgb_raw_t getLastRawColor();
+
+  /**
+   * 直近に取得した右モータ角位置を取得（モータへの再問い合わせはしない）
+   * @return 直近に取得した右モータ角位置[deg]
+   */
+  static int getLastRightCount();
+
+  /**
+   * 直近に取得した左モータ角位置を取得（モータへの再問い合わせはしない）
+   * @return 直近に取得した左モータ角位置[deg]
+   */
+  static int getLastLeftCount();
+
+  /**
+   * 起動時からの右モータ角位置を取得（resetCount()などによる初期化の影響を受けない）
+   * @return 起動時からの右モータ角位置[deg]
+   */
+  static int getRightTotalCount();
+
+  /**
+   * 起動時からの左モータ角位置を取得（resetCount()などによる初期化の影響を受けない）
+   * @return 起動時からの左モータ角位置[deg]
+   */
+  static int getLeftTotalCount();
+
+  /**
+   * 直近に取得した起動時からの右モータ角位置を取得（モータへの再問い合わせはしない）
+   * @return 直近に取得した起動時からの右モータ角位置[deg]
+   */
+  static int getLastRightTotalCount();
+
+  /**
+   * 直近に取得した起動時からの左モータ角位置を取得（モータへの再問い合わせはしない）
+   * @return 直近に取得した起動時からの左モータ角位置[deg]
+   */
+  static int getLastLeftTotalCount();
+
+ private:
+  static rgb_raw_t lastRawColor;  // 直近に取得したRGB値
+  static int lastRightCount;      // 直近に取得した右モータ角位置
+  static int lastLeftCount;       // 直近に取得した左モータ角位置
+  static int rightCountOffset;    // 初期化で失われた右モータ角位置の累計
+  static int leftCountOffset;     // 初期化で失われた左モータ角位置の累計
 };
 
 #endif
\ No newline at end of file
@@ -20,6 +20,33 @@ void Timer::sleep(int milliSec)
 // 走行時間を測定（ミリ秒）
 int Timer::now()
 {
-  // マイクロ秒をミリ秒になおしてreturn
-  return int(clock->now()) / 1000;
+  // マイクロ秒をミリ秒になおしてreturn(int型に変換する前に割ることで桁あふれを防ぐ)
+  return static_cast<int>(clock->now() / 1000);
+}
+
+// 走行時間を測定（マイクロ秒）
+uint64_t Timer::nowMicro()
+{
+  return clock->now();
+}
+
+// 走行時間を測定（ナノ秒）
+uint64_t Timer::nowNano()
+{
+  return clock->now() * 1000;
+}
+
+// 指定時刻からの経過時間（マイクロ秒）
+uint64_t Timer::elapsedMicro(uint64_t startMicro)
+{
+  uint64_t currentMicro = clock->now();
+  return currentMicro > startMicro ? currentMicro - startMicro : 0;
+}
+
+// 指定時刻まで自タスクスリープ
+void Timer::sleepUntil(uint64_t targetMicro)
+{
+  uint64_t currentMicro = clock->now();
+  if(currentMicro >= targetMicro) return;
+  clock->sleep(static_cast<int>(targetMicro - currentMicro));
 }
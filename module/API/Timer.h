@@ -7,6 +7,7 @@
 #ifndef TIMER_H
 #define TIMER_H
 
+#include <stdint.h>
 #include "ev3api.h"
 #include "Clock.h"
 
@@ -30,6 +31,32 @@ class Timer {
    * @return 走行時間(ミリ秒)
    */
   int now();
+
+  /**
+   * 走行時間を取得
+   * @return 走行時間(マイクロ秒)
+   */
+  uint64_t nowMicro();
+
+  /**
+   * 走行時間を取得
+   * @return 走行時間(ナノ秒)
+   * @note 分解能はクロックと同じマイクロ秒
+   */
+  uint64_t nowNano();
+
+  /**
+   * 指定時刻からの経過時間を取得
+   * @param startMicro 計測開始時刻(マイクロ秒)
+   * @return 経過時間(マイクロ秒、指定時刻が未来の場合は0)
+   */
+  uint64_t elapsedMicro(uint64_t startMicro);
+
+  /**
+   * 指定時刻まで自タスクスリープ（指定時刻を過ぎている場合はスリープしない）
+   * @param targetMicro 起床時刻(マイクロ秒)
+   */
+  void sleepUntil(uint64_t targetMicro);
 };
 
 #endif
\ No newline at end of file
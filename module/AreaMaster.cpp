@@ -40,7 +40,35 @@ void AreaMaster::run()
   // 各動作を実行する
   for(const auto& motion : motionList) {
     Measurer::resetCount();
+    // 動作の切り替え時に電圧を測定し、PWM値の補正比率を更新する
+    Controller::updateVoltage();
+    // 動作の開始時点の位置と向きに更新する
+    Odometry::update();
+    LoopProfiler::reset();
     motion->logRunning();
+    // 制限時間・制限距離を監視しながら動作を実行する
+    MotionWatchdog::start(motion->getTimeLimit(), motion->getDistanceLimit());
     motion->run();
+    MotionWatchdog::stop();
+    // 制御ループの周期を出力する
+    LoopProfiler::logSummary();
+
+    // 制限を超えた動作の設定に応じて、残りの動作を打ち切る
+    if(MotionWatchdog::hasExpired() && motion->getWatchdogReaction() == WATCHDOG_REACTION::ABORT) {
+      logger.logWarning("Abort the remaining commands because the watchdog expired");
+      break;
+    }
+    // 目的を果たせずに打ち切られた動作の後は、誤った位置から残りの動作を続けない
+    if(motion->isFailed()) {
+      logger.logWarning("Abort the remaining commands because the motion failed");
+      break;
+    }
   }
+
+  // エリア走行後の位置と向きのログを出す
+  Odometry::update();
+  Pose pose = Odometry::getPose();
+  snprintf(buf, BUF_SIZE, "Pose (x: %.1f, y: %.1f, theta: %.1f[deg])", pose.x, pose.y,
+           pose.theta * 180.0 / M_PI);
+  logger.log(buf);
 }
\ No newline at end of file
@@ -13,6 +13,9 @@
 #include "MotionParser.h"
 #include "Logger.h"
 #include "Measurer.h"
+#include "Controller.h"
+#include "LoopProfiler.h"
+#include "Odometry.h"
 
 // エリア名を持つ列挙型変数（LineTrace = 0, DoubleLoop = 1, BlockDeTreasure = 2）
 enum Area { LineTrace, DoubleLoop, BlockDeTreasure };
@@ -0,0 +1,74 @@
+/**
+ * @file ArmController.cpp
+ * @brief 加減速を制限した目標角位置の軌道にPIDで追従させ、アームの静定を判定するクラス
+ * @author KatLab
+ */
+
+#include "ArmController.h"
+
+ArmController::ArmController(double _maxPwm, double _maxSpeed, double _maxAcceleration)
+  : maxPwm(fabs(_maxPwm)),
+    maxSpeed(fabs(_maxSpeed)),
+    maxAcceleration(fabs(_maxAcceleration)),
+    targetCount(0),
+    setpoint(0.0),
+    setpointSpeed(0.0),
+    prevCount(0),
+    settledTime(0.0),
+    pid(KP, KI, KD, 0.0)
+{
+  pid.setOutputLimit(-maxPwm, maxPwm);
+}
+
+void ArmController::start(int initialCount, int _targetCount)
+{
+  targetCount = _targetCount;
+  setpoint = initialCount;
+  setpointSpeed = 0.0;
+  prevCount = initialCount;
+  settledTime = 0.0;
+  pid = Pid(KP, KI, KD, setpoint);
+  pid.setOutputLimit(-maxPwm, maxPwm);
+}
+
+double ArmController::update(int currentCount, double delta)
+{
+  // 残りの角度で止まりきれる角速度を上限に、加減速を制限して軌道を進める
+  double remaining = targetCount - setpoint;
+  double direction = remaining >= 0.0 ? 1.0 : -1.0;
+  double desiredSpeed
+      = std::min(maxSpeed, sqrt(2.0 * maxAcceleration * fabs(remaining))) * direction;
+  double maxSpeedChange = maxAcceleration * delta;
+  setpointSpeed += std::max(std::min(desiredSpeed - setpointSpeed, maxSpeedChange),
+                            -maxSpeedChange);
+  setpoint += setpointSpeed * delta;
+
+  // 目標を越えた場合は目標で止める
+  if((targetCount - setpoint) * direction <= 0.0) {
+    setpoint = targetCount;
+    setpointSpeed = 0.0;
+  }
+
+  // 軌道が目標に達し、角位置が目標付近で止まっている時間を積み上げる
+  bool isStill = abs(currentCount - prevCount) <= 1;
+  if(setpoint == targetCount && abs(targetCount - currentCount) <= SETTLE_TOLERANCE && isStill) {
+    settledTime += delta;
+  } else {
+    settledTime = 0.0;
+  }
+  prevCount = currentCount;
+
+  // 軌道の目標角位置との差をPIDで補正する
+  pid.setTargetValue(setpoint);
+  return pid.calculatePid(currentCount, delta);
+}
+
+bool ArmController::isSettled()
+{
+  return settledTime >= SETTLE_DURATION;
+}
+
+double ArmController::getSetpoint()
+{
+  return setpoint;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ArmController.h
+ * @brief 加減速を制限した目標角位置の軌道にPIDで追従させ、アームの静定を判定するクラス
+ * @author KatLab
+ */
+
+#ifndef ARM_CONTROLLER_H
+#define ARM_CONTROLLER_H
+
+#include <stdlib.h>
+#include <cmath>
+#include <algorithm>
+#include "Pid.h"
+
+class ArmController {
+ public:
+  /**
+   * コンストラクタ
+   * @param _maxPwm PWM値の絶対値の上限
+   * @param _maxSpeed 軌道の角速度の上限[deg/s]
+   * @param _maxAcceleration 軌道の角加速度の上限[deg/s^2]
+   */
+  ArmController(double _maxPwm, double _maxSpeed = MAX_SPEED,
+                double _maxAcceleration = MAX_ACCELERATION);
+
+  /**
+   * @brief 目標角位置への移動を始める
+   * @param initialCount 現在のアームモータ角位置[deg]
+   * @param _targetCount 目標のアームモータ角位置[deg]
+   */
+  void start(int initialCount, int _targetCount);
+
+  /**
+   * @brief 軌道を1周期分進め、アームモータに指令するPWM値を求める
+   * @param currentCount 現在のアームモータ角位置[deg]
+   * @param delta 前回の計算からの経過時間[s]
+   * @return アームモータに指令するPWM値
+   * @note 制御周期ごとに呼び出す
+   */
+  double update(int currentCount, double delta);
+
+  /**
+   * @brief アームが目標角位置で静定したかを取得する
+   * @return true:軌道が目標に達し、角位置がSETTLE_TOLERANCE以内でSETTLE_DURATION止まっている,
+   *         false:静定していない
+   */
+  bool isSettled();
+
+  /**
+   * @brief 軌道の現在の目標角位置を取得する
+   * @return 軌道の目標角位置[deg]
+   */
+  double getSetpoint();
+
+  static constexpr double KP = 2.0;                  // 角位置のPゲイン
+  static constexpr double KI = 0.5;                  // 角位置のIゲイン
+  static constexpr double KD = 0.05;                 // 角位置のDゲイン
+  static constexpr double MAX_SPEED = 150.0;         // 軌道の角速度の上限の既定値[deg/s]
+  static constexpr double MAX_ACCELERATION = 600.0;  // 軌道の角加速度の上限の既定値[deg/s^2]
+  static constexpr int SETTLE_TOLERANCE = 2;         // 静定とみなす目標との差[deg]
+  static constexpr double SETTLE_DURATION = 0.05;     // 静定とみなす停止の継続時間[s]
+
+ private:
+  double maxPwm;
+  double maxSpeed;
+  double maxAcceleration;
+  int targetCount;       // 目標のアームモータ角位置[deg]
+  double setpoint;       // 軌道の目標角位置[deg]
+  double setpointSpeed;  // 軌道の角速度[deg/s]
+  int prevCount;         // 前回のアームモータ角位置[deg]
+  double settledTime;    // 目標付近で止まっている時間[s]
+  Pid pid;
+};
+
+#endif
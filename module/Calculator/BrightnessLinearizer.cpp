@@ -0,0 +1,97 @@
+/**
+ * @file BrightnessLinearizer.cpp
+ * @brief キャリブレーションで求めた変換表で輝度を線形化するクラス
+ * @author KatLab
+ */
+
+#include "BrightnessLinearizer.h"
+
+constexpr const char* BrightnessLinearizer::DEFAULT_FILE_PATH;
+double BrightnessLinearizer::table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT] = {};
+bool BrightnessLinearizer::isTableEnabled = false;
+
+void BrightnessLinearizer::setTable(
+    const double _table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT])
+{
+  for(int i = 0; i < BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT; i++) {
+    table[i] = _table[i];
+  }
+  isTableEnabled = true;
+}
+
+void BrightnessLinearizer::clear()
+{
+  isTableEnabled = false;
+}
+
+bool BrightnessLinearizer::isEnabled()
+{
+  return isTableEnabled;
+}
+
+double BrightnessLinearizer::linearize(double brightness)
+{
+  if(!isTableEnabled) return brightness;
+
+  // 変換表の範囲外は端の値を使う
+  const int MAX_INDEX = BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT - 1;
+  if(brightness <= 0.0) return table[0];
+  if(brightness >= MAX_INDEX) return table[MAX_INDEX];
+
+  // 前後の段階の値を線形補間する
+  int index = static_cast<int>(brightness);
+  double ratio = brightness - index;
+  return table[index] + (table[index + 1] - table[index]) * ratio;
+}
+
+bool BrightnessLinearizer::load(const char* filePath)
+{
+  const int BUF_SIZE = 128;
+  FILE* fp = fopen(filePath, "r");
+  // ファイルがない場合は線形化しない
+  if(fp == NULL) return false;
+
+  double loaded[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];
+  bool isLoaded[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT] = {};
+  char row[BUF_SIZE];  // 各行の文字を一時的に保持する領域
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    int brightness;
+    double value;
+    if(sscanf(row, "%d,%lf", &brightness, &value) != 2) continue;
+    if(brightness < 0 || brightness >= BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT) continue;
+    loaded[brightness] = value;
+    isLoaded[brightness] = true;
+  }
+  fclose(fp);
+
+  // 段階が欠けている場合は使わない
+  for(int i = 0; i < BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT; i++) {
+    if(!isLoaded[i]) {
+      Logger logger;
+      char buf[BUF_SIZE];
+      snprintf(buf, BUF_SIZE, "Brightness transfer function '%s' is incomplete", filePath);
+      logger.logWarning(buf);
+      return false;
+    }
+  }
+
+  setTable(loaded);
+  return true;
+}
+
+bool BrightnessLinearizer::save(const char* filePath)
+{
+  if(!isTableEnabled) return false;
+
+  FILE* fp = fopen(filePath, "w");
+  if(fp == NULL) {
+    Logger logger;
+    logger.logWarning("cannot open brightness transfer function file");
+    return false;
+  }
+  for(int i = 0; i < BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT; i++) {
+    fprintf(fp, "%d,%f\n", i, table[i]);
+  }
+  fclose(fp);
+  return true;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file BrightnessLinearizer.h
+ * @brief キャリブレーションで求めた変換表で輝度を線形化するクラス
+ * @author KatLab
+ */
+
+#ifndef BRIGHTNESS_LINEARIZER_H
+#define BRIGHTNESS_LINEARIZER_H
+
+#include <stdio.h>
+#include "BrightnessStatistics.h"
+#include "Logger.h"
+
+class BrightnessLinearizer {
+ public:
+  BrightnessLinearizer() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 変換表を設定し、線形化を有効にする
+   * @param table 生の輝度(添字)から線形化した輝度への変換表
+   */
+  static void setTable(const double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT]);
+
+  /**
+   * @brief 変換表を破棄し、線形化を無効にする
+   */
+  static void clear();
+
+  /**
+   * @brief 線形化が有効かどうかを取得する
+   * @return true:変換表で線形化する, false:生の輝度のまま
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief 輝度を線形化する
+   * @param brightness 生の輝度
+   * @return 線形化した輝度(無効な場合は生の輝度のまま。整数でない輝度は前後の値を補間する)
+   */
+  static double linearize(double brightness);
+
+  /**
+   * @brief 変換表をファイルから読み込み、線形化を有効にする
+   * @param filePath ファイルのパス
+   * @return true:読み込めた, false:ファイルがないか、段階が欠けている(線形化は無効のまま)
+   * @note ファイルの各行は「生の輝度,線形化した輝度」とする
+   */
+  static bool load(const char* filePath = DEFAULT_FILE_PATH);
+
+  /**
+   * @brief 変換表をファイルに書き出す
+   * @param filePath ファイルのパス
+   * @return true:書き出せた, false:線形化が無効か、ファイルを開けない
+   */
+  static bool save(const char* filePath = DEFAULT_FILE_PATH);
+
+  static constexpr const char* DEFAULT_FILE_PATH = "brightness_transfer.csv";
+
+ private:
+  static double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];  // 変換表
+  static bool isTableEnabled;  // true:変換表で線形化する, false:生の輝度のまま
+};
+
+#endif
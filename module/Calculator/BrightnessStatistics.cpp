@@ -0,0 +1,145 @@
+/**
+ * @file BrightnessStatistics.cpp
+ * @brief キャリブレーションで集めた輝度の分布を集計するクラス
+ * @author KatLab
+ */
+
+#include "BrightnessStatistics.h"
+
+BrightnessStatistics::BrightnessStatistics() : histogram(), sampleCount(0) {}
+
+void BrightnessStatistics::addSample(int brightness)
+{
+  if(brightness < 0) brightness = 0;
+  if(brightness >= BRIGHTNESS_LEVEL_COUNT) brightness = BRIGHTNESS_LEVEL_COUNT - 1;
+  histogram[brightness]++;
+  sampleCount++;
+}
+
+int BrightnessStatistics::getSampleCount()
+{
+  return sampleCount;
+}
+
+int BrightnessStatistics::getMin()
+{
+  for(int i = 0; i < BRIGHTNESS_LEVEL_COUNT; i++) {
+    if(histogram[i] > 0) return i;
+  }
+  return 0;
+}
+
+int BrightnessStatistics::getMax()
+{
+  for(int i = BRIGHTNESS_LEVEL_COUNT - 1; i >= 0; i--) {
+    if(histogram[i] > 0) return i;
+  }
+  return 0;
+}
+
+double BrightnessStatistics::getMean()
+{
+  return calcRangeMean(0, BRIGHTNESS_LEVEL_COUNT, 0.0);
+}
+
+double BrightnessStatistics::getStandardDeviation()
+{
+  if(sampleCount == 0) return 0.0;
+  double mean = getMean();
+  double sum = 0.0;
+  for(int i = 0; i < BRIGHTNESS_LEVEL_COUNT; i++) {
+    sum += histogram[i] * (i - mean) * (i - mean);
+  }
+  return sqrt(sum / sampleCount);
+}
+
+int BrightnessStatistics::calcThreshold()
+{
+  if(sampleCount == 0) return 0;
+
+  // クラス間分散が最大になる閾値を探す(大津の方法)
+  double totalSum = 0.0;
+  for(int i = 0; i < BRIGHTNESS_LEVEL_COUNT; i++) {
+    totalSum += static_cast<double>(i) * histogram[i];
+  }
+  int bestThreshold = 0;
+  double bestVariance = -1.0;
+  int darkCount = 0;     // 閾値より暗いサンプルの数
+  double darkSum = 0.0;  // 閾値より暗いサンプルの輝度の合計
+  for(int threshold = 1; threshold < BRIGHTNESS_LEVEL_COUNT; threshold++) {
+    darkCount += histogram[threshold - 1];
+    darkSum += static_cast<double>(threshold - 1) * histogram[threshold - 1];
+    int brightCount = sampleCount - darkCount;
+    if(darkCount == 0 || brightCount == 0) continue;
+    double darkMean = darkSum / darkCount;
+    double brightMean = (totalSum - darkSum) / brightCount;
+    double variance = static_cast<double>(darkCount) * brightCount * (darkMean - brightMean)
+                      * (darkMean - brightMean);
+    if(variance > bestVariance) {
+      bestVariance = variance;
+      bestThreshold = threshold;
+    }
+  }
+
+  // 全てのサンプルが同じ輝度の場合はその輝度を閾値とする
+  if(bestVariance < 0.0) return getMin();
+  return bestThreshold;
+}
+
+double BrightnessStatistics::calcBlackLevel()
+{
+  return calcRangeMean(0, calcThreshold(), getMin());
+}
+
+double BrightnessStatistics::calcWhiteLevel()
+{
+  return calcRangeMean(calcThreshold(), BRIGHTNESS_LEVEL_COUNT, getMax());
+}
+
+void BrightnessStatistics::buildTransferFunction(double table[BRIGHTNESS_LEVEL_COUNT])
+{
+  // 黒と白の上に止まっている間のサンプルが集まる、最頻の輝度を黒と白の輝度とする
+  int threshold = calcThreshold();
+  int blackLevel = calcMode(0, threshold);
+  int whiteLevel = calcMode(threshold, BRIGHTNESS_LEVEL_COUNT);
+
+  // 黒と白の輝度の間にあるサンプル(ラインの縁を横切っている間のサンプル)を数える
+  int transitionCount = 0;
+  for(int i = 0; i < BRIGHTNESS_LEVEL_COUNT; i++) {
+    if(i > blackLevel && i < whiteLevel) transitionCount += histogram[i];
+  }
+
+  int cumulativeCount = 0;  // 生の輝度より暗い、縁を横切っている間のサンプルの数
+  for(int i = 0; i < BRIGHTNESS_LEVEL_COUNT; i++) {
+    if(i <= blackLevel || i >= whiteLevel || transitionCount == 0) {
+      // 黒と白の輝度の外側、または縁のサンプルがない場合は生の輝度のまま
+      table[i] = i;
+    } else {
+      // 累積分布の中央値の位置に比例する輝度を割り当てる
+      double position = (cumulativeCount + histogram[i] / 2.0) / transitionCount;
+      table[i] = blackLevel + (whiteLevel - blackLevel) * position;
+    }
+    if(i > blackLevel && i < whiteLevel) cumulativeCount += histogram[i];
+  }
+}
+
+double BrightnessStatistics::calcRangeMean(int begin, int end, double defaultValue)
+{
+  int count = 0;
+  double sum = 0.0;
+  for(int i = begin; i < end; i++) {
+    count += histogram[i];
+    sum += static_cast<double>(i) * histogram[i];
+  }
+  if(count == 0) return defaultValue;
+  return sum / count;
+}
+
+int BrightnessStatistics::calcMode(int begin, int end)
+{
+  int mode = begin;
+  for(int i = begin; i < end; i++) {
+    if(histogram[i] > histogram[mode]) mode = i;
+  }
+  return mode;
+}
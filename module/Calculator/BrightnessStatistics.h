@@ -0,0 +1,106 @@
+/**
+ * @file BrightnessStatistics.h
+ * @brief キャリブレーションで集めた輝度の分布を集計するクラス
+ * @author KatLab
+ */
+
+#ifndef BRIGHTNESS_STATISTICS_H
+#define BRIGHTNESS_STATISTICS_H
+
+#include <math.h>
+
+class BrightnessStatistics {
+ public:
+  static constexpr int BRIGHTNESS_LEVEL_COUNT = 101;  // 輝度の段階数(0~100)
+
+  /**
+   * コンストラクタ
+   */
+  BrightnessStatistics();
+
+  /**
+   * @brief 輝度のサンプルを追加する
+   * @param brightness 輝度(0~100の範囲に収めて集計する)
+   */
+  void addSample(int brightness);
+
+  /**
+   * @brief 追加したサンプルの数を取得する
+   * @return サンプルの数
+   */
+  int getSampleCount();
+
+  /**
+   * @brief 輝度の最小値を取得する
+   * @return 最小値(サンプルがない場合は0)
+   */
+  int getMin();
+
+  /**
+   * @brief 輝度の最大値を取得する
+   * @return 最大値(サンプルがない場合は0)
+   */
+  int getMax();
+
+  /**
+   * @brief 輝度の平均値を取得する
+   * @return 平均値(サンプルがない場合は0)
+   */
+  double getMean();
+
+  /**
+   * @brief 輝度の標準偏差を取得する
+   * @return 標準偏差(サンプルがない場合は0)
+   */
+  double getStandardDeviation();
+
+  /**
+   * @brief 大津の方法で黒と白を分ける最適な閾値を求める
+   * @return 閾値(この値以上を白側とする。サンプルがない場合は0)
+   */
+  int calcThreshold();
+
+  /**
+   * @brief 閾値より暗いサンプルの平均(黒の輝度)を求める
+   * @return 黒の輝度(該当するサンプルがない場合は最小値)
+   */
+  double calcBlackLevel();
+
+  /**
+   * @brief 閾値以上のサンプルの平均(白の輝度)を求める
+   * @return 白の輝度(該当するサンプルがない場合は最大値)
+   */
+  double calcWhiteLevel();
+
+  /**
+   * @brief 生の輝度から線形化した輝度への変換表(センサの伝達関数の逆関数)を作る
+   * @param table 変換表を格納する配列(添字が生の輝度)
+   * @note ラインを一定の速さで横切ったときのサンプルを前提とし、黒と白の最頻の輝度の間の
+   *       サンプルの累積分布を位置とみなして、その間を位置に比例するよう割り当て直す。
+   *       黒と白の最頻の輝度の外側は生の輝度のままとする
+   */
+  void buildTransferFunction(double table[BRIGHTNESS_LEVEL_COUNT]);
+
+ private:
+  int histogram[BRIGHTNESS_LEVEL_COUNT];  // 輝度ごとのサンプル数
+  int sampleCount;                        // サンプルの数
+
+  /**
+   * @brief 指定範囲の輝度のサンプルの平均を求める
+   * @param begin 範囲の始まり(この値を含む)
+   * @param end 範囲の終わり(この値を含まない)
+   * @param defaultValue 範囲にサンプルがない場合の値
+   * @return 平均値
+   */
+  double calcRangeMean(int begin, int end, double defaultValue);
+
+  /**
+   * @brief 指定範囲で最もサンプルが多い輝度を求める
+   * @param begin 範囲の始まり(この値を含む)
+   * @param end 範囲の終わり(この値を含まない)
+   * @return 最頻の輝度(同数の場合は暗い方。範囲にサンプルがない場合はbegin)
+   */
+  int calcMode(int begin, int end);
+};
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file ColorEventDetector.cpp
+ * @brief 直近の色判定の多数決と走行距離で、指定色の区間に入ったことを確定するクラス
+ * @author KatLab
+ */
+
+#include "ColorEventDetector.h"
+
+ColorEventDetector::ColorEventDetector(COLOR _targetColor, int _windowSize, int _enterVote,
+                                       int _exitVote, double _confirmDistance)
+  : targetColor(_targetColor),
+    windowSize(std::max(std::min(_windowSize, MAX_WINDOW_SIZE), 1)),
+    enterVote(std::max(std::min(_enterVote, windowSize), 1)),
+    exitVote(std::max(std::min(_exitVote, enterVote - 1), 0)),
+    confirmDistance(std::max(_confirmDistance, 0.0))
+{
+  reset();
+}
+
+bool ColorEventDetector::update(COLOR color, const Pose& pose)
+{
+  // 前回からの移動距離を累計する(曲線でも道のりになるよう、周期ごとの直線距離を足す)
+  if(sampleCount > 0) {
+    pathLength += std::hypot(pose.x - prevPose.x, pose.y - prevPose.y);
+  }
+  prevPose = pose;
+
+  // 窓が埋まっている場合は最も古い色判定を票から除く
+  if(sampleCount == windowSize) {
+    if(window[nextIndex].isMatched) vote--;
+  } else {
+    sampleCount++;
+  }
+  bool isMatched = color == targetColor;
+  window[nextIndex] = { isMatched, pose, pathLength };
+  nextIndex = (nextIndex + 1) % windowSize;
+  if(isMatched) vote++;
+
+  // 票数にヒステリシスを持たせて状態を遷移させる
+  if(state == COLOR_EVENT_STATE::ABSENT) {
+    if(vote >= enterVote) {
+      state = COLOR_EVENT_STATE::CANDIDATE;
+      markStart();
+    }
+  } else if(vote <= exitVote) {
+    state = COLOR_EVENT_STATE::ABSENT;
+  }
+
+  // 疑いが始まってから確定距離を走ったら確定する
+  if(state == COLOR_EVENT_STATE::CANDIDATE && pathLength - startPathLength >= confirmDistance) {
+    state = COLOR_EVENT_STATE::DETECTED;
+    overshootDistance = pathLength - startPathLength;
+  }
+
+  return state == COLOR_EVENT_STATE::DETECTED;
+}
+
+void ColorEventDetector::reset()
+{
+  sampleCount = 0;
+  nextIndex = 0;
+  vote = 0;
+  pathLength = 0.0;
+  prevPose = { 0.0, 0.0, 0.0 };
+  state = COLOR_EVENT_STATE::ABSENT;
+  startPose = { 0.0, 0.0, 0.0 };
+  startPathLength = 0.0;
+  overshootDistance = 0.0;
+}
+
+COLOR_EVENT_STATE ColorEventDetector::getState()
+{
+  return state;
+}
+
+Pose ColorEventDetector::getStartPose()
+{
+  return startPose;
+}
+
+double ColorEventDetector::getOvershootDistance()
+{
+  return overshootDistance;
+}
+
+void ColorEventDetector::logDetection()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  snprintf(buf, BUF_SIZE, "Color event (color: %s, start: (%.1f, %.1f), overshoot: %.1fmm)",
+           ColorJudge::colorToString(targetColor), startPose.x, startPose.y, overshootDistance);
+  logger.log(buf);
+}
+
+COLOR ColorEventDetector::getTargetColor()
+{
+  return targetColor;
+}
+
+void ColorEventDetector::markStart()
+{
+  // 窓内の色判定を古い順にたどる
+  int oldestIndex = (nextIndex - sampleCount + windowSize) % windowSize;
+  for(int i = 0; i < sampleCount; i++) {
+    const Sample& sample = window[(oldestIndex + i) % windowSize];
+    if(sample.isMatched) {
+      startPose = sample.pose;
+      startPathLength = sample.pathLength;
+      return;
+    }
+  }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file ColorEventDetector.h
+ * @brief 直近の色判定の多数決と走行距離で、指定色の区間に入ったことを確定するクラス
+ * @author KatLab
+ */
+
+#ifndef COLOR_EVENT_DETECTOR_H
+#define COLOR_EVENT_DETECTOR_H
+
+#include <cmath>
+#include <algorithm>
+#include "ColorJudge.h"
+#include "Odometry.h"
+#include "Logger.h"
+
+// 指定色の検知状態
+enum class COLOR_EVENT_STATE {
+  ABSENT,     // 指定色の区間の外
+  CANDIDATE,  // 指定色の区間に入った疑いがある(確定距離を走っていない)
+  DETECTED,   // 指定色の区間に入ったことを確定した
+};
+
+class ColorEventDetector {
+ public:
+  /**
+   * コンストラクタ
+   * @param _targetColor 指定色
+   * @param _windowSize 多数決に使う直近の色判定の数(1~MAX_WINDOW_SIZE)
+   * @param _enterVote 疑いありとみなす指定色の票数(1~_windowSize)
+   * @param _exitVote 区間の外とみなす指定色の票数(_enterVote未満)
+   * @param _confirmDistance 疑いが始まってから確定までに走る距離[mm]
+   * @note _windowSize=1, _enterVote=1, _exitVote=0, _confirmDistance=0で1回の判定で確定する
+   */
+  ColorEventDetector(COLOR _targetColor, int _windowSize = WINDOW_SIZE,
+                     int _enterVote = ENTER_VOTE, int _exitVote = EXIT_VOTE,
+                     double _confirmDistance = CONFIRM_DISTANCE);
+
+  /**
+   * @brief 色判定を1つ加え、検知状態を更新する
+   * @param color 判定した色
+   * @param pose 色を判定したときの走行体の位置と向き
+   * @return true:指定色の区間に入ったことを確定している, false:確定していない
+   * @note 制御周期ごとに呼び出す
+   */
+  bool update(COLOR color, const Pose& pose);
+
+  /**
+   * @brief 判定の途中経過を破棄する
+   */
+  void reset();
+
+  /**
+   * @brief 検知状態を取得する
+   * @return 検知状態
+   */
+  COLOR_EVENT_STATE getState();
+
+  /**
+   * @brief 指定色の区間が始まった位置を取得する
+   * @return 窓内で最初に指定色と判定したときの走行体の位置と向き(疑いがないときは最後の確定時の値)
+   */
+  Pose getStartPose();
+
+  /**
+   * @brief 指定色の区間が始まってから確定までに走った距離を取得する
+   * @return 確定時の行き過ぎ距離[mm](確定したことがない場合は0)
+   */
+  double getOvershootDistance();
+
+  /**
+   * @brief 確定した指定色の区間の始まりと行き過ぎ距離をログに出力する
+   */
+  void logDetection();
+
+  /**
+   * @brief 指定色を取得する
+   * @return 指定色
+   */
+  COLOR getTargetColor();
+
+  static constexpr int MAX_WINDOW_SIZE = 16;       // 多数決に使う色判定の数の上限
+  static constexpr int WINDOW_SIZE = 5;            // 多数決に使う色判定の数の既定値
+  static constexpr int ENTER_VOTE = 3;             // 疑いありとみなす票数の既定値
+  static constexpr int EXIT_VOTE = 1;              // 区間の外とみなす票数の既定値
+  static constexpr double CONFIRM_DISTANCE = 5.0;  // 確定までに走る距離の既定値[mm]
+
+ private:
+  // 窓に保持する色判定
+  struct Sample {
+    bool isMatched;     // true:指定色, false:指定色以外
+    Pose pose;          // 判定したときの位置と向き
+    double pathLength;  // 判定したときの累計走行距離[mm]
+  };
+
+  COLOR targetColor;
+  int windowSize;
+  int enterVote;
+  int exitVote;
+  double confirmDistance;
+  Sample window[MAX_WINDOW_SIZE];  // 直近の色判定(リングバッファ)
+  int sampleCount;                 // 窓に保持している色判定の数
+  int nextIndex;                   // 次に色判定を書き込む位置
+  int vote;                        // 窓内の指定色の票数
+  double pathLength;               // 累計走行距離[mm]
+  Pose prevPose;                   // 前回の位置と向き
+  COLOR_EVENT_STATE state;
+  Pose startPose;                  // 指定色の区間が始まった位置と向き
+  double startPathLength;          // 指定色の区間が始まったときの累計走行距離[mm]
+  double overshootDistance;        // 確定時の行き過ぎ距離[mm]
+
+  /**
+   * @brief 窓内で最初に指定色と判定した色判定を区間の始まりとして記録する
+   */
+  void markStart();
+};
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file CurvatureSpeedPlanner.cpp
+ * @brief 走行中の曲率に応じてライントレースの目標速度を決めるクラス
+ * @author KatLab
+ */
+
+#include "CurvatureSpeedPlanner.h"
+
+CurvatureSpeedPlanner::CurvatureSpeedPlanner(double _minSpeed, double _maxSpeed)
+  : minSpeed(std::min(fabs(_minSpeed), fabs(_maxSpeed))),
+    maxSpeed(std::max(fabs(_minSpeed), fabs(_maxSpeed))),
+    sign(_maxSpeed < 0.0 ? -1.0 : 1.0),
+    curvature(0.0),
+    speed(minSpeed)
+{
+}
+
+double CurvatureSpeedPlanner::calculateSpeed(double turnPwm, double basePwm, double delta)
+{
+  // 走行速度の推定値を更新し、車輪の速度差から今の曲率を求める
+  SpeedEstimator::update();
+  double rightSpeed = SpeedEstimator::getRightSpeed();
+  double leftSpeed = SpeedEstimator::getLeftSpeed();
+  double wheelCurvature = fabs(GainScheduler::calcCurvature(rightSpeed, leftSpeed));
+  // 旋回値からこれから曲がろうとしている曲率を見積もる
+  double turnCurvature = calcTurnCurvature(turnPwm, basePwm);
+
+  // 大きい方の曲率を採用し、ノイズで速度が揺れないよう平滑化する
+  double currentCurvature = std::max(wheelCurvature, turnCurvature);
+  curvature += CURVATURE_FILTER_ALPHA * (currentCurvature - curvature);
+
+  // 曲率が大きいほど遅くする
+  double ratio = std::min(curvature / CURVE_CURVATURE, 1.0);
+  double targetSpeed = maxSpeed - (maxSpeed - minSpeed) * ratio;
+
+  // 加減速度の上限を超えないように目標速度を変える(減速は早めに行う)
+  if(targetSpeed > speed) {
+    speed = std::min(targetSpeed, speed + ACCELERATION * delta);
+  } else {
+    speed = std::max(targetSpeed, speed - DECELERATION * delta);
+  }
+
+  return speed * sign;
+}
+
+double CurvatureSpeedPlanner::calcTurnCurvature(double turnPwm, double basePwm)
+{
+  if(basePwm == 0.0) return 0.0;
+  // 曲率 = (左右の速度差 / トレッド幅) / 平均速度 ≒ (2 * 旋回値 / PWM値の平均) / トレッド幅
+  return fabs(2.0 * turnPwm / basePwm) / TREAD;
+}
+
+double CurvatureSpeedPlanner::getCurvature()
+{
+  return curvature;
+}
+
+double CurvatureSpeedPlanner::getSpeed()
+{
+  return speed * sign;
+}
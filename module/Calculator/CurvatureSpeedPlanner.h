@@ -0,0 +1,69 @@
+/**
+ * @file CurvatureSpeedPlanner.h
+ * @brief 走行中の曲率に応じてライントレースの目標速度を決めるクラス
+ * @author KatLab
+ */
+
+#ifndef CURVATURE_SPEED_PLANNER_H
+#define CURVATURE_SPEED_PLANNER_H
+
+#include <algorithm>
+#include "GainScheduler.h"
+#include "SpeedEstimator.h"
+#include "SystemInfo.h"
+
+class CurvatureSpeedPlanner {
+ public:
+  /**
+   * コンストラクタ
+   * @param _minSpeed 曲率がCURVE_CURVATURE以上のカーブでの目標速度[mm/s]
+   * @param _maxSpeed 直線での目標速度[mm/s]
+   * @note 後退する場合は負の速度を渡す。目標速度は_minSpeedから加速し始める
+   */
+  CurvatureSpeedPlanner(double _minSpeed, double _maxSpeed);
+
+  /**
+   * @brief 曲率を推定し、目標速度を更新する
+   * @param turnPwm 直前の周期の旋回値
+   * @param basePwm 直前の周期の旋回値を加える前の左右のPWM値の平均
+   * @param delta 前回の更新からの経過時間[s]
+   * @return 目標速度[mm/s]
+   * @note 制御周期ごとに呼び出す
+   */
+  double calculateSpeed(double turnPwm, double basePwm, double delta);
+
+  /**
+   * @brief 旋回値から走行軌跡の曲率を見積もる
+   * @param turnPwm 旋回値
+   * @param basePwm 旋回値を加える前の左右のPWM値の平均
+   * @return 曲率の大きさ[1/mm](basePwmが0の場合は0)
+   * @note 左右のPWM値の差(2 * turnPwm)と速度の差が比例すると見なす
+   */
+  static double calcTurnCurvature(double turnPwm, double basePwm);
+
+  /**
+   * @brief 直近に推定した曲率の大きさを取得する
+   * @return 曲率の大きさ[1/mm]
+   */
+  double getCurvature();
+
+  /**
+   * @brief 直近の目標速度を取得する
+   * @return 目標速度[mm/s]
+   */
+  double getSpeed();
+
+  static constexpr double CURVE_CURVATURE = 1.0 / 300.0;  // _minSpeedまで減速する曲率[1/mm]
+  static constexpr double CURVATURE_FILTER_ALPHA = 0.3;   // 曲率の平滑化係数
+  static constexpr double ACCELERATION = 300.0;           // 加速度の上限[mm/s^2]
+  static constexpr double DECELERATION = 1500.0;          // 減速度の上限[mm/s^2]
+
+ private:
+  double minSpeed;   // カーブでの目標速度の大きさ[mm/s]
+  double maxSpeed;   // 直線での目標速度の大きさ[mm/s]
+  double sign;       // 走行方向(1:前進, -1:後退)
+  double curvature;  // 直近に推定した曲率の大きさ[1/mm]
+  double speed;      // 直近の目標速度の大きさ[mm/s]
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file FeedforwardModel.cpp
+ * @brief 走行速度からPWM値へのフィードフォワードモデルを車輪ごとに保持・較正するクラス
+ * @author KatLab
+ */
+
+#include "FeedforwardModel.h"
+
+constexpr const char* FeedforwardModel::DEFAULT_FILE_PATH;
+FeedforwardParam FeedforwardModel::right(FeedforwardModel::DEFAULT_DEADBAND_PWM,
+                                         FeedforwardModel::DEFAULT_SLOPE);
+FeedforwardParam FeedforwardModel::left(FeedforwardModel::DEFAULT_DEADBAND_PWM,
+                                        FeedforwardModel::DEFAULT_SLOPE);
+double FeedforwardModel::samplePwms[FeedforwardModel::MAX_SAMPLE_COUNT] = {};
+double FeedforwardModel::sampleRightSpeeds[FeedforwardModel::MAX_SAMPLE_COUNT] = {};
+double FeedforwardModel::sampleLeftSpeeds[FeedforwardModel::MAX_SAMPLE_COUNT] = {};
+int FeedforwardModel::sampleCount = 0;
+
+FeedforwardParam FeedforwardModel::getRight()
+{
+  return right;
+}
+
+FeedforwardParam FeedforwardModel::getLeft()
+{
+  return left;
+}
+
+void FeedforwardModel::set(const FeedforwardParam& _right, const FeedforwardParam& _left)
+{
+  right = _right;
+  left = _left;
+}
+
+void FeedforwardModel::reset()
+{
+  right = FeedforwardParam(DEFAULT_DEADBAND_PWM, DEFAULT_SLOPE);
+  left = FeedforwardParam(DEFAULT_DEADBAND_PWM, DEFAULT_SLOPE);
+}
+
+void FeedforwardModel::clearSamples()
+{
+  sampleCount = 0;
+}
+
+void FeedforwardModel::addSample(double pwm, double rightSpeed, double leftSpeed)
+{
+  if(sampleCount >= MAX_SAMPLE_COUNT) return;
+  samplePwms[sampleCount] = fabs(pwm);
+  sampleRightSpeeds[sampleCount] = fabs(rightSpeed);
+  sampleLeftSpeeds[sampleCount] = fabs(leftSpeed);
+  sampleCount++;
+}
+
+bool FeedforwardModel::fit()
+{
+  FeedforwardParam fittedRight(DEFAULT_DEADBAND_PWM, DEFAULT_SLOPE);
+  FeedforwardParam fittedLeft(DEFAULT_DEADBAND_PWM, DEFAULT_SLOPE);
+  // 片方の車輪だけ較正できた場合も、左右の組がそろわないため更新しない
+  if(!fitWheel(sampleRightSpeeds, fittedRight) || !fitWheel(sampleLeftSpeeds, fittedLeft)) {
+    return false;
+  }
+  right = fittedRight;
+  left = fittedLeft;
+  return true;
+}
+
+bool FeedforwardModel::fitWheel(const double* speeds, FeedforwardParam& param)
+{
+  // PWM = 不感帯 + 傾き * 速度 を最小二乗法で求める
+  int count = 0;
+  double speedSum = 0.0;
+  double pwmSum = 0.0;
+  double speedSquareSum = 0.0;
+  double productSum = 0.0;
+  for(int i = 0; i < sampleCount; i++) {
+    if(speeds[i] < MIN_SAMPLE_SPEED) continue;  // 不感帯内のサンプルは使わない
+    count++;
+    speedSum += speeds[i];
+    pwmSum += samplePwms[i];
+    speedSquareSum += speeds[i] * speeds[i];
+    productSum += speeds[i] * samplePwms[i];
+  }
+  if(count < 2) return false;
+  double denominator = count * speedSquareSum - speedSum * speedSum;
+  if(denominator <= 0.0) return false;  // 速度がすべて同じ場合は傾きを求められない
+
+  double slope = (count * productSum - speedSum * pwmSum) / denominator;
+  double deadbandPwm = (pwmSum - slope * speedSum) / count;
+  if(slope <= 0.0) return false;
+  // 計測誤差で不感帯が負になった場合は0とする
+  param = FeedforwardParam(deadbandPwm > 0.0 ? deadbandPwm : 0.0, slope);
+  return true;
+}
+
+bool FeedforwardModel::load(const char* filePath)
+{
+  const int BUF_SIZE = 128;
+  FILE* fp = fopen(filePath, "r");
+  // ファイルがない場合は既定値を使う
+  if(fp == NULL) return false;
+
+  FeedforwardParam loadedRight(0.0, 0.0);
+  FeedforwardParam loadedLeft(0.0, 0.0);
+  bool isRightLoaded = false;
+  bool isLeftLoaded = false;
+  char row[BUF_SIZE];  // 各行の文字を一時的に保持する領域
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    char wheel;
+    double deadbandPwm;
+    double slope;
+    if(sscanf(row, "%c,%lf,%lf", &wheel, &deadbandPwm, &slope) != 3) continue;
+    if(deadbandPwm < 0.0 || slope <= 0.0) continue;
+    if(wheel == 'R') {
+      loadedRight = FeedforwardParam(deadbandPwm, slope);
+      isRightLoaded = true;
+    } else if(wheel == 'L') {
+      loadedLeft = FeedforwardParam(deadbandPwm, slope);
+      isLeftLoaded = true;
+    }
+  }
+  fclose(fp);
+
+  // 左右の組がそろわない場合は使わない
+  if(!isRightLoaded || !isLeftLoaded) {
+    Logger logger;
+    char buf[BUF_SIZE];
+    snprintf(buf, BUF_SIZE, "Feedforward model '%s' is incomplete", filePath);
+    logger.logWarning(buf);
+    return false;
+  }
+  right = loadedRight;
+  left = loadedLeft;
+  return true;
+}
+
+bool FeedforwardModel::save(const char* filePath)
+{
+  FILE* fp = fopen(filePath, "w");
+  if(fp == NULL) {
+    Logger logger;
+    logger.logWarning("cannot open feedforward model file");
+    return false;
+  }
+  fprintf(fp, "R,%f,%f\n", right.deadbandPwm, right.slope);
+  fprintf(fp, "L,%f,%f\n", left.deadbandPwm, left.slope);
+  fclose(fp);
+  return true;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file FeedforwardModel.h
+ * @brief 走行速度からPWM値へのフィードフォワードモデルを車輪ごとに保持・較正するクラス
+ * @author KatLab
+ */
+
+#ifndef FEEDFORWARD_MODEL_H
+#define FEEDFORWARD_MODEL_H
+
+#include <stdio.h>
+#include <math.h>
+#include "Logger.h"
+
+// 1つの車輪のフィードフォワードモデル(PWM = 不感帯 + 傾き * |速度|)
+struct FeedforwardParam {
+  double deadbandPwm;  // 車輪が回り始めるPWM値
+  double slope;        // 速度あたりのPWM値[1/(mm/s)]
+
+  FeedforwardParam(double _deadbandPwm, double _slope) : deadbandPwm(_deadbandPwm), slope(_slope)
+  {
+  }
+};
+
+class FeedforwardModel {
+ public:
+  FeedforwardModel() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 右車輪のモデルを取得する
+   * @return 右車輪のモデル
+   */
+  static FeedforwardParam getRight();
+
+  /**
+   * @brief 左車輪のモデルを取得する
+   * @return 左車輪のモデル
+   */
+  static FeedforwardParam getLeft();
+
+  /**
+   * @brief 左右の車輪のモデルを設定する
+   * @param right 右車輪のモデル
+   * @param left 左車輪のモデル
+   */
+  static void set(const FeedforwardParam& right, const FeedforwardParam& left);
+
+  /**
+   * @brief 左右の車輪のモデルを既定値に戻す
+   */
+  static void reset();
+
+  /**
+   * @brief 較正のためのサンプルを破棄する
+   */
+  static void clearSamples();
+
+  /**
+   * @brief 較正のためのサンプルを追加する
+   * @param pwm 左右の車輪に指令したPWM値(正の値)
+   * @param rightSpeed そのPWM値で定常になった右車輪の走行速度[mm/s]
+   * @param leftSpeed そのPWM値で定常になった左車輪の走行速度[mm/s]
+   */
+  static void addSample(double pwm, double rightSpeed, double leftSpeed);
+
+  /**
+   * @brief 追加したサンプルに最小二乗法で直線を当てはめ、左右の車輪のモデルを更新する
+   * @return true:更新した, false:車輪が回ったサンプルが足りない、または当てはめた直線が不正
+   * @note 車輪が回らなかった(速度がMIN_SAMPLE_SPEED未満の)サンプルは不感帯内として使わない
+   */
+  static bool fit();
+
+  /**
+   * @brief モデルをファイルから読み込む
+   * @param filePath ファイルパス
+   * @return true:読み込んだ, false:ファイルがない、または内容が不正(モデルは変えない)
+   */
+  static bool load(const char* filePath = DEFAULT_FILE_PATH);
+
+  /**
+   * @brief モデルをファイルに書き出す
+   * @param filePath ファイルパス
+   * @return true:書き出した, false:ファイルを開けない
+   */
+  static bool save(const char* filePath = DEFAULT_FILE_PATH);
+
+  static constexpr const char* DEFAULT_FILE_PATH = "feedforward.csv";
+  static constexpr double DEFAULT_DEADBAND_PWM = 8.0;  // 較正前の不感帯のPWM値
+  static constexpr double DEFAULT_SLOPE = 0.115;       // 較正前の速度あたりのPWM値[1/(mm/s)]
+  static constexpr double MIN_SAMPLE_SPEED = 10.0;     // 車輪が回ったとみなす走行速度[mm/s]
+  static constexpr int MAX_SAMPLE_COUNT = 16;          // 保持するサンプルの上限
+
+ private:
+  static FeedforwardParam right;
+  static FeedforwardParam left;
+  static double samplePwms[MAX_SAMPLE_COUNT];
+  static double sampleRightSpeeds[MAX_SAMPLE_COUNT];
+  static double sampleLeftSpeeds[MAX_SAMPLE_COUNT];
+  static int sampleCount;
+
+  /**
+   * @brief 1つの車輪のサンプルに直線を当てはめる
+   * @param speeds 車輪の走行速度のサンプル[mm/s]
+   * @param param 当てはめたモデルを格納する変数
+   * @return true:当てはめた, false:サンプルが足りない、または直線が不正
+   */
+  static bool fitWheel(const double* speeds, FeedforwardParam& param);
+};
+
+#endif
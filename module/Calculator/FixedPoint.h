@@ -0,0 +1,124 @@
+/**
+ * @file FixedPoint.h
+ * @brief 固定小数点数を表すクラス
+ * @author KatLab
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <stdint.h>
+
+/**
+ * 小数部FRAC_BITSビットの32ビット固定小数点数
+ * @note 浮動小数点演算器のない環境で、ソフトウェアによる浮動小数点演算の代わりに
+ *       整数演算で計算するために使う。演算結果が表現範囲を超えた場合は上限・下限に飽和させる
+ */
+template <int FRAC_BITS>
+class FixedPoint {
+ public:
+  static constexpr int32_t ONE = static_cast<int32_t>(1) << FRAC_BITS;  // 1.0の内部表現
+  static constexpr int32_t RAW_MAX = INT32_MAX;                          // 内部表現の上限
+  static constexpr int32_t RAW_MIN = INT32_MIN;                          // 内部表現の下限
+
+  /**
+   * コンストラクタ
+   */
+  FixedPoint() : raw(0) {}
+
+  /**
+   * 浮動小数点数から変換するコンストラクタ
+   * @param value 変換する値
+   * @note 定数やセンサ値を渡す際に暗黙に変換できるようexplicitにしない
+   */
+  FixedPoint(double value)
+    : raw(saturate(static_cast<int64_t>(value * ONE + (value < 0.0 ? -0.5 : 0.5))))
+  {
+  }
+
+  /**
+   * 整数から変換するコンストラクタ
+   * @param value 変換する値
+   * @note 浮動小数点演算を使わずに変換する
+   */
+  FixedPoint(int value) : raw(saturate(static_cast<int64_t>(value) * ONE)) {}
+
+  /**
+   * @brief 内部表現から固定小数点数を作る
+   * @param raw 内部表現
+   * @return 固定小数点数
+   */
+  static FixedPoint fromRaw(int32_t raw)
+  {
+    FixedPoint value;
+    value.raw = raw;
+    return value;
+  }
+
+  /**
+   * @brief 内部表現を取得する
+   * @return 内部表現
+   */
+  int32_t getRaw() const { return raw; }
+
+  /**
+   * @brief 浮動小数点数に変換する
+   */
+  explicit operator double() const { return static_cast<double>(raw) / ONE; }
+
+  FixedPoint operator-() const { return fromRaw(saturate(-static_cast<int64_t>(raw))); }
+
+  FixedPoint operator+(const FixedPoint& other) const
+  {
+    return fromRaw(saturate(static_cast<int64_t>(raw) + other.raw));
+  }
+
+  FixedPoint operator-(const FixedPoint& other) const
+  {
+    return fromRaw(saturate(static_cast<int64_t>(raw) - other.raw));
+  }
+
+  FixedPoint operator*(const FixedPoint& other) const
+  {
+    // 64ビットで積を求めてから小数部のビット数だけ戻す
+    return fromRaw(saturate((static_cast<int64_t>(raw) * other.raw) >> FRAC_BITS));
+  }
+
+  FixedPoint operator/(const FixedPoint& other) const
+  {
+    // 0除算の場合は符号に応じて飽和させる
+    if(other.raw == 0) return fromRaw(raw >= 0 ? RAW_MAX : RAW_MIN);
+    return fromRaw(saturate((static_cast<int64_t>(raw) << FRAC_BITS) / other.raw));
+  }
+
+  FixedPoint& operator+=(const FixedPoint& other) { return *this = *this + other; }
+  FixedPoint& operator-=(const FixedPoint& other) { return *this = *this - other; }
+  FixedPoint& operator*=(const FixedPoint& other) { return *this = *this * other; }
+  FixedPoint& operator/=(const FixedPoint& other) { return *this = *this / other; }
+
+  bool operator==(const FixedPoint& other) const { return raw == other.raw; }
+  bool operator!=(const FixedPoint& other) const { return raw != other.raw; }
+  bool operator<(const FixedPoint& other) const { return raw < other.raw; }
+  bool operator>(const FixedPoint& other) const { return raw > other.raw; }
+  bool operator<=(const FixedPoint& other) const { return raw <= other.raw; }
+  bool operator>=(const FixedPoint& other) const { return raw >= other.raw; }
+
+ private:
+  int32_t raw;  // 内部表現(値 * 2^FRAC_BITS)
+
+  /**
+   * @brief 64ビットの値を32ビットの範囲に飽和させる
+   * @param value 値
+   * @return 飽和させた値
+   */
+  static int32_t saturate(int64_t value)
+  {
+    if(value > RAW_MAX) return RAW_MAX;
+    if(value < RAW_MIN) return RAW_MIN;
+    return static_cast<int32_t>(value);
+  }
+};
+
+typedef FixedPoint<16> Q16_16;  // 整数部16ビット、小数部16ビットの固定小数点数
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file GainScheduler.cpp
+ * @brief 走行速度と走行中の曲率に応じてライントレースのPIDゲインを補間するクラス
+ * @author KatLab
+ */
+
+#include "GainScheduler.h"
+
+GainScheduler::GainScheduler(const std::vector<GainScheduleLevel>& _levels)
+  : levels(_levels), curvature(0.0), weight(0.0), speed(0.0)
+{
+  // 補間する速度の区間を探せるよう、速度の昇順に並べる
+  std::stable_sort(levels.begin(), levels.end(), isSlower);
+}
+
+PidGain GainScheduler::calculateGain()
+{
+  // 走行速度の推定値を更新する
+  SpeedEstimator::update();
+  double rightSpeed = SpeedEstimator::getRightSpeed();
+  double leftSpeed = SpeedEstimator::getLeftSpeed();
+  speed = fabs(rightSpeed + leftSpeed) / 2.0;
+
+  // 低速時は速度差から曲率を正しく推定できないため、前回の重みを使い続ける
+  if(speed >= MIN_SPEED) {
+    curvature = calcCurvature(rightSpeed, leftSpeed);
+    // 曲率が大きいほどcurveGainの重みを大きくし、急にゲインが変わらないよう平滑化する
+    double targetWeight = std::min(fabs(curvature) / CURVE_CURVATURE, 1.0);
+    weight += WEIGHT_FILTER_ALPHA * (targetWeight - weight);
+  }
+
+  if(levels.empty()) return PidGain(0.0, 0.0, 0.0);
+
+  // 走行速度を挟む2つの速度を探す(範囲外の場合は端の速度のPIDゲインを使う)
+  size_t upper = 0;
+  while(upper < levels.size() && levels[upper].speed < speed) {
+    upper++;
+  }
+  size_t lower = upper > 0 ? upper - 1 : 0;
+  upper = std::min(upper, levels.size() - 1);
+
+  // それぞれの速度で曲率に応じて補間し、さらに走行速度に応じて補間する
+  PidGain lowerGain = interpolate(levels[lower].straightGain, levels[lower].curveGain, weight);
+  PidGain upperGain = interpolate(levels[upper].straightGain, levels[upper].curveGain, weight);
+  double speedRange = levels[upper].speed - levels[lower].speed;
+  double speedWeight = speedRange > 0.0 ? (speed - levels[lower].speed) / speedRange : 0.0;
+  return interpolate(lowerGain, upperGain, speedWeight);
+}
+
+double GainScheduler::calcCurvature(double rightSpeed, double leftSpeed)
+{
+  double meanSpeed = (rightSpeed + leftSpeed) / 2.0;
+  if(meanSpeed == 0.0) return 0.0;
+  // 曲率 = 角速度 / 速度 = ((右速度 - 左速度) / トレッド幅) / 平均速度
+  return (rightSpeed - leftSpeed) / (TREAD * meanSpeed);
+}
+
+PidGain GainScheduler::interpolate(const PidGain& straightGain, const PidGain& curveGain,
+                                   double weight)
+{
+  weight = std::max(std::min(weight, 1.0), 0.0);
+  return PidGain(straightGain.kp + (curveGain.kp - straightGain.kp) * weight,
+                 straightGain.ki + (curveGain.ki - straightGain.ki) * weight,
+                 straightGain.kd + (curveGain.kd - straightGain.kd) * weight);
+}
+
+double GainScheduler::getCurvature()
+{
+  return curvature;
+}
+
+double GainScheduler::getWeight()
+{
+  return weight;
+}
+
+double GainScheduler::getSpeed()
+{
+  return speed;
+}
+
+bool GainScheduler::isSlower(const GainScheduleLevel& a, const GainScheduleLevel& b)
+{
+  return a.speed < b.speed;
+}
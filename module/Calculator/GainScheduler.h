@@ -0,0 +1,98 @@
+/**
+ * @file GainScheduler.h
+ * @brief 走行速度と走行中の曲率に応じてライントレースのPIDゲインを補間するクラス
+ * @author KatLab
+ */
+
+#ifndef GAIN_SCHEDULER_H
+#define GAIN_SCHEDULER_H
+
+#include <algorithm>
+#include <vector>
+#include "Pid.h"
+#include "SpeedEstimator.h"
+#include "SystemInfo.h"
+
+// ゲインスケジュールの1つの速度での直線とカーブのPIDゲイン
+struct GainScheduleLevel {
+  double speed;          // このPIDゲインを使う平均走行速度[mm/s]
+  PidGain straightGain;  // 直線(曲率0)でのPIDゲイン
+  PidGain curveGain;     // CURVE_CURVATURE以上の曲率のカーブでのPIDゲイン
+
+  GainScheduleLevel(double _speed, const PidGain& _straightGain, const PidGain& _curveGain)
+    : speed(_speed), straightGain(_straightGain), curveGain(_curveGain)
+  {
+  }
+};
+
+class GainScheduler {
+ public:
+  /**
+   * コンストラクタ
+   * @param _levels 速度ごとの直線とカーブのPIDゲイン(1つ以上、速度の順は問わない)
+   * @note 1つの場合は走行速度によらず、曲率だけでPIDゲインを補間する
+   */
+  GainScheduler(const std::vector<GainScheduleLevel>& _levels);
+
+  /**
+   * @brief 左右の車輪の推定走行速度から曲率を推定し、走行速度と曲率でPIDゲインを双線形補間する
+   * @return 補間したPIDゲイン
+   * @note 制御周期ごとに呼び出す。走行速度がMIN_SPEED未満の間は曲率を更新しない
+   */
+  PidGain calculateGain();
+
+  /**
+   * @brief 左右の車輪の走行速度から走行軌跡の曲率を求める
+   * @param rightSpeed 右車輪の走行速度[mm/s]
+   * @param leftSpeed 左車輪の走行速度[mm/s]
+   * @return 曲率[1/mm](左に曲がる場合が正、平均速度が0の場合は0)
+   */
+  static double calcCurvature(double rightSpeed, double leftSpeed);
+
+  /**
+   * @brief 2つのPIDゲインを線形補間する
+   * @param straightGain 重み0でのPIDゲイン
+   * @param curveGain 重み1でのPIDゲイン
+   * @param weight curveGainの重み(0~1)
+   * @return 補間したPIDゲイン
+   */
+  static PidGain interpolate(const PidGain& straightGain, const PidGain& curveGain, double weight);
+
+  /**
+   * @brief 直近に推定した曲率を取得する
+   * @return 曲率[1/mm]
+   */
+  double getCurvature();
+
+  /**
+   * @brief 直近のcurveGainの重みを取得する
+   * @return curveGainの重み(0~1)
+   */
+  double getWeight();
+
+  /**
+   * @brief 直近に補間に使った平均走行速度を取得する
+   * @return 平均走行速度の大きさ[mm/s]
+   */
+  double getSpeed();
+
+  static constexpr double CURVE_CURVATURE = 1.0 / 300.0;  // curveGainを使い切る曲率[1/mm]
+  static constexpr double MIN_SPEED = 50.0;  // 曲率を推定する平均走行速度の下限[mm/s]
+  static constexpr double WEIGHT_FILTER_ALPHA = 0.2;  // 重みの平滑化係数
+
+ private:
+  std::vector<GainScheduleLevel> levels;  // 速度の昇順に並べた速度ごとのPIDゲイン
+  double curvature;                       // 直近に推定した曲率[1/mm]
+  double weight;                          // curveGainの重み(0~1)
+  double speed;                           // 直近に補間に使った平均走行速度[mm/s]
+
+  /**
+   * @brief 速度の昇順に並べるための比較をする
+   * @param a 比較するPIDゲイン
+   * @param b 比較するPIDゲイン
+   * @return true:aの速度がbより小さい, false:それ以外
+   */
+  static bool isSlower(const GainScheduleLevel& a, const GainScheduleLevel& b);
+};
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file LateralOffsetEstimator.cpp
+ * @brief 輝度からラインの縁に対するカラーセンサの横ずれを推定するクラス
+ * @author KatLab
+ */
+
+#include "LateralOffsetEstimator.h"
+
+constexpr const char* LateralOffsetEstimator::DEFAULT_FILE_PATH;
+double LateralOffsetEstimator::offsetSums[LateralOffsetEstimator::LEVEL_COUNT] = {};
+int LateralOffsetEstimator::sampleCounts[LateralOffsetEstimator::LEVEL_COUNT] = {};
+double LateralOffsetEstimator::table[LateralOffsetEstimator::LEVEL_COUNT] = {};
+bool LateralOffsetEstimator::isTableEnabled = false;
+
+void LateralOffsetEstimator::clearSamples()
+{
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    offsetSums[i] = 0.0;
+    sampleCounts[i] = 0;
+  }
+}
+
+void LateralOffsetEstimator::addSample(int brightness, double offset)
+{
+  if(brightness < 0) brightness = 0;
+  if(brightness >= LEVEL_COUNT) brightness = LEVEL_COUNT - 1;
+  offsetSums[brightness] += offset;
+  sampleCounts[brightness]++;
+}
+
+bool LateralOffsetEstimator::build()
+{
+  // 輝度ごとの横ずれの平均を求め、輝度に対する横ずれの共分散から傾きの向きを調べる
+  double means[LEVEL_COUNT];
+  int levelCount = 0;  // サンプルのある輝度の段階数
+  int totalCount = 0;
+  double brightnessSum = 0.0;
+  double offsetSum = 0.0;
+  double productSum = 0.0;
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    if(sampleCounts[i] == 0) continue;
+    means[i] = offsetSums[i] / sampleCounts[i];
+    levelCount++;
+    totalCount += sampleCounts[i];
+    brightnessSum += static_cast<double>(i) * sampleCounts[i];
+    offsetSum += offsetSums[i];
+    productSum += i * offsetSums[i];
+  }
+  if(levelCount < 2) return false;
+  double covariance = totalCount * productSum - brightnessSum * offsetSum;
+  double sign = covariance < 0.0 ? -1.0 : 1.0;  // 白に近いほど横ずれが大きくなる向きにそろえる
+
+  int prevIndex = -1;  // 直前のサンプルのある輝度
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    if(sampleCounts[i] == 0) continue;
+    if(prevIndex < 0) {
+      // 最も暗いサンプルより暗い輝度はその横ずれとする
+      for(int j = 0; j <= i; j++) table[j] = means[i] * sign;
+    } else {
+      // 暗い方から単調増加になるよう補正し、間のサンプルのない輝度は線形補間する
+      table[i] = std::max(means[i] * sign, table[prevIndex]);
+      for(int j = prevIndex + 1; j < i; j++) {
+        double ratio = static_cast<double>(j - prevIndex) / (i - prevIndex);
+        table[j] = table[prevIndex] + (table[i] - table[prevIndex]) * ratio;
+      }
+    }
+    prevIndex = i;
+  }
+  // 最も明るいサンプルより明るい輝度はその横ずれとする
+  for(int j = prevIndex + 1; j < LEVEL_COUNT; j++) {
+    table[j] = table[prevIndex];
+  }
+
+  isTableEnabled = true;
+  return true;
+}
+
+void LateralOffsetEstimator::clear()
+{
+  isTableEnabled = false;
+}
+
+bool LateralOffsetEstimator::isEnabled()
+{
+  return isTableEnabled;
+}
+
+double LateralOffsetEstimator::estimate(double brightness)
+{
+  if(!isTableEnabled) return 0.0;
+
+  // 変換表の範囲外は端の値を使う
+  if(brightness <= 0.0) return table[0];
+  if(brightness >= LEVEL_COUNT - 1) return table[LEVEL_COUNT - 1];
+
+  // 前後の段階の値を線形補間する
+  int index = static_cast<int>(brightness);
+  double ratio = brightness - index;
+  return table[index] + (table[index + 1] - table[index]) * ratio;
+}
+
+bool LateralOffsetEstimator::load(const char* filePath)
+{
+  const int BUF_SIZE = 128;
+  FILE* fp = fopen(filePath, "r");
+  // ファイルがない場合は推定しない
+  if(fp == NULL) return false;
+
+  double loaded[LEVEL_COUNT];
+  bool isLoaded[LEVEL_COUNT] = {};
+  char row[BUF_SIZE];  // 各行の文字を一時的に保持する領域
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    int brightness;
+    double offset;
+    if(sscanf(row, "%d,%lf", &brightness, &offset) != 2) continue;
+    if(brightness < 0 || brightness >= LEVEL_COUNT) continue;
+    loaded[brightness] = offset;
+    isLoaded[brightness] = true;
+  }
+  fclose(fp);
+
+  // 段階が欠けている場合は使わない
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    if(!isLoaded[i]) {
+      Logger logger;
+      char buf[BUF_SIZE];
+      snprintf(buf, BUF_SIZE, "Lateral offset table '%s' is incomplete", filePath);
+      logger.logWarning(buf);
+      return false;
+    }
+  }
+
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    table[i] = loaded[i];
+  }
+  isTableEnabled = true;
+  return true;
+}
+
+bool LateralOffsetEstimator::save(const char* filePath)
+{
+  if(!isTableEnabled) return false;
+
+  FILE* fp = fopen(filePath, "w");
+  if(fp == NULL) {
+    Logger logger;
+    logger.logWarning("cannot open lateral offset table file");
+    return false;
+  }
+  for(int i = 0; i < LEVEL_COUNT; i++) {
+    fprintf(fp, "%d,%f\n", i, table[i]);
+  }
+  fclose(fp);
+  return true;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file LateralOffsetEstimator.h
+ * @brief 輝度からラインの縁に対するカラーセンサの横ずれを推定するクラス
+ * @author KatLab
+ */
+
+#ifndef LATERAL_OFFSET_ESTIMATOR_H
+#define LATERAL_OFFSET_ESTIMATOR_H
+
+#include <stdio.h>
+#include <algorithm>
+#include "BrightnessStatistics.h"
+#include "Logger.h"
+
+class LateralOffsetEstimator {
+ public:
+  LateralOffsetEstimator() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 変換表を作るためのサンプルを破棄する
+   */
+  static void clearSamples();
+
+  /**
+   * @brief 変換表を作るためのサンプルを追加する
+   * @param brightness 輝度(0~100)
+   * @param offset そのときのカラーセンサの横ずれ[mm]
+   */
+  static void addSample(int brightness, double offset);
+
+  /**
+   * @brief 追加したサンプルから輝度→横ずれの変換表を作り、推定を有効にする
+   * @return true:作れた, false:サンプルの輝度が2段階未満で作れない(推定は無効のまま)
+   * @note 横ずれは輝度が高い(白に近い)ほど大きくなる向きにそろえ、単調増加になるよう補正する。
+   *       サンプルのない輝度は前後の輝度から線形補間する
+   */
+  static bool build();
+
+  /**
+   * @brief 変換表を破棄し、推定を無効にする
+   */
+  static void clear();
+
+  /**
+   * @brief 推定が有効かどうかを取得する
+   * @return true:変換表がある, false:ない
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief 輝度から横ずれを推定する
+   * @param brightness 輝度(整数でない輝度は前後の値を補間する)
+   * @return 横ずれ[mm](無効な場合は0)
+   */
+  static double estimate(double brightness);
+
+  /**
+   * @brief 変換表をファイルから読み込み、推定を有効にする
+   * @param filePath ファイルのパス
+   * @return true:読み込めた, false:ファイルがないか、段階が欠けている(推定は無効のまま)
+   * @note ファイルの各行は「輝度,横ずれ[mm]」とする
+   */
+  static bool load(const char* filePath = DEFAULT_FILE_PATH);
+
+  /**
+   * @brief 変換表をファイルに書き出す
+   * @param filePath ファイルのパス
+   * @return true:書き出せた, false:推定が無効か、ファイルを開けない
+   */
+  static bool save(const char* filePath = DEFAULT_FILE_PATH);
+
+  static constexpr const char* DEFAULT_FILE_PATH = "lateral_offset.csv";
+
+ private:
+  static constexpr int LEVEL_COUNT = BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT;
+  static double offsetSums[LEVEL_COUNT];  // 輝度ごとの横ずれの合計[mm]
+  static int sampleCounts[LEVEL_COUNT];   // 輝度ごとのサンプル数
+  static double table[LEVEL_COUNT];       // 輝度→横ずれ[mm]の変換表
+  static bool isTableEnabled;             // true:変換表がある, false:ない
+};
+
+#endif
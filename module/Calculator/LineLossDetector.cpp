@@ -0,0 +1,82 @@
+/**
+ * @file LineLossDetector.cpp
+ * @brief 輝度の履歴と旋回値の飽和・向きの変化から、ラインを見失ったことを検知するクラス
+ * @author KatLab
+ */
+
+#include "LineLossDetector.h"
+
+LineLossDetector::LineLossDetector(bool _isLeftEdge) : isLeftEdge(_isLeftEdge)
+{
+  reset();
+}
+
+bool LineLossDetector::update(double deviation, bool isTurnSaturated, double theta,
+                              uint64_t currentTime)
+{
+  if(isLost) return true;
+
+  // 偏差が同じ側に外れ続けている間だけ、外れの継続時間と向きの変化を積み上げる
+  int side = 0;
+  if(deviation <= -OFF_LINE_MARGIN) {
+    side = 1;  // 輝度が目標より大きい(白側)
+  } else if(deviation >= OFF_LINE_MARGIN) {
+    side = -1;  // 輝度が目標より小さい(黒側)
+  }
+  if(side == 0 || side != offLineSide) {
+    offLineSide = side;
+    offLineStartTime = currentTime;
+    headingChange = 0.0;
+  } else {
+    // 左エッジで白側に外れた場合は反時計回りがラインから離れる向きになる(黒側・右エッジは逆)
+    // ラインへ戻る向きの旋回は離れた分だけを打ち消し、修正の旋回を見失ったとはみなさない
+    // 1回転以上回り続けても累計できるよう、周期ごとの変化を足す
+    int awaySign = isLeftEdge ? offLineSide : -offLineSide;
+    headingChange += Odometry::normalizeAngle(theta - prevTheta) * awaySign;
+    if(headingChange < 0.0) headingChange = 0.0;
+  }
+  prevTheta = theta;
+
+  if(!isTurnSaturated) {
+    isSaturating = false;
+  } else if(!isSaturating) {
+    isSaturating = true;
+    saturationStartTime = currentTime;
+  }
+
+  // 外れが続いたうえで、旋回値が飽和し続けているか向きが大きく変わったら見失ったとみなす
+  if(offLineSide != 0 && currentTime - offLineStartTime >= LOSS_DURATION) {
+    bool isSaturated = isSaturating && currentTime - saturationStartTime >= SATURATION_DURATION;
+    if(isSaturated || headingChange >= LOSS_HEADING_CHANGE) {
+      isLost = true;
+    }
+  }
+  return isLost;
+}
+
+void LineLossDetector::reset()
+{
+  offLineSide = 0;
+  offLineStartTime = 0;
+  prevTheta = 0.0;
+  headingChange = 0.0;
+  isSaturating = false;
+  saturationStartTime = 0;
+  isLost = false;
+}
+
+int LineLossDetector::getOffLineSide()
+{
+  return offLineSide;
+}
+
+uint64_t LineLossDetector::getOffLineDuration(uint64_t currentTime)
+{
+  if(offLineSide == 0) return 0;
+  return currentTime - offLineStartTime;
+}
+
+double LineLossDetector::getHeadingChange()
+{
+  return headingChange;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file LineLossDetector.h
+ * @brief 輝度の履歴と旋回値の飽和・向きの変化から、ラインを見失ったことを検知するクラス
+ * @author KatLab
+ */
+
+#ifndef LINE_LOSS_DETECTOR_H
+#define LINE_LOSS_DETECTOR_H
+
+#include <stdint.h>
+#include <cmath>
+#include "Odometry.h"
+
+class LineLossDetector {
+ public:
+  /**
+   * コンストラクタ
+   * @param _isLeftEdge エッジの左右判定(true:左エッジ, false:右エッジ)
+   * @note エッジと外れた側から、ラインから離れる向きを判断する
+   */
+  LineLossDetector(bool _isLeftEdge);
+
+  /**
+   * @brief 1周期分の状態を加え、ラインを見失ったか判定する
+   * @param deviation 目標輝度 - 輝度
+   * @param isTurnSaturated true:旋回値で内輪のPWM値が0に張り付いている, false:張り付いていない
+   * @param theta 走行体の向き[rad]
+   * @param currentTime 現在時刻[us]
+   * @return true:ラインを見失った, false:見失っていない
+   * @note 制御周期ごとに呼び出す。見失ったと判定した後はreset()するまでtrueを返し続ける
+   */
+  bool update(double deviation, bool isTurnSaturated, double theta, uint64_t currentTime);
+
+  /**
+   * @brief 判定の途中経過を破棄する
+   */
+  void reset();
+
+  /**
+   * @brief ラインから外れた側を取得する
+   * @return 1:白側(輝度が目標より大きい), -1:黒側(輝度が目標より小さい), 0:外れていない
+   */
+  int getOffLineSide();
+
+  /**
+   * @brief ラインから外れ続けている時間を取得する
+   * @param currentTime 現在時刻[us]
+   * @return 外れ続けている時間[us](外れていない場合は0)
+   */
+  uint64_t getOffLineDuration(uint64_t currentTime);
+
+  /**
+   * @brief ラインから外れてから、ラインから離れる向きに変わった量を取得する
+   * @return 向きの変化[rad](0以上。ラインへ戻る向きの旋回で打ち消した分は含めない)
+   */
+  double getHeadingChange();
+
+  static constexpr double OFF_LINE_MARGIN = 10.0;            // 外れたとみなす偏差の大きさ
+  static constexpr uint64_t LOSS_DURATION = 200000;          // 見失ったとみなす外れの継続時間[us]
+  static constexpr uint64_t SATURATION_DURATION = 100000;    // 旋回値の飽和の継続時間[us]
+  static constexpr double LOSS_HEADING_CHANGE = M_PI / 4.0;  // 見失ったとみなす向きの変化[rad]
+
+ private:
+  bool isLeftEdge;               // エッジの左右判定(true:左エッジ, false:右エッジ)
+  int offLineSide;               // ラインから外れた側(1:白側, -1:黒側, 0:外れていない)
+  uint64_t offLineStartTime;     // ラインから外れ始めた時刻[us]
+  double prevTheta;              // 前回の向き[rad]
+  double headingChange;          // ラインから外れてから離れる向きに変わった量[rad]
+  bool isSaturating;             // true:旋回値の飽和が続いている, false:続いていない
+  uint64_t saturationStartTime;  // 旋回値の飽和が始まった時刻[us]
+  bool isLost;                   // true:見失ったと判定済み, false:未判定
+};
+
+#endif
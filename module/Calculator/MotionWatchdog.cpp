@@ -0,0 +1,75 @@
+/**
+ * @file MotionWatchdog.cpp
+ * @brief 動作ごとの制限時間・制限距離を監視し、超えたら動作を打ち切らせるクラス
+ * @author KatLab
+ */
+
+#include "MotionWatchdog.h"
+
+bool MotionWatchdog::isWatching = false;
+bool MotionWatchdog::expired = false;
+int MotionWatchdog::timeLimit = 0;
+double MotionWatchdog::distanceLimit = 0.0;
+uint64_t MotionWatchdog::startTime = 0;
+int MotionWatchdog::initRightCount = 0;
+int MotionWatchdog::initLeftCount = 0;
+
+void MotionWatchdog::start(int _timeLimit, double _distanceLimit)
+{
+  Timer timer;
+  timeLimit = _timeLimit;
+  distanceLimit = _distanceLimit;
+  startTime = timer.nowMicro();
+  // resetCount()の影響を受けない起動時からの角位置で走行距離を測る
+  initRightCount = Measurer::getRightTotalCount();
+  initLeftCount = Measurer::getLeftTotalCount();
+  expired = false;
+  isWatching = true;
+}
+
+void MotionWatchdog::stop()
+{
+  isWatching = false;
+}
+
+bool MotionWatchdog::isExpired()
+{
+  if(!isWatching) return false;
+  if(expired) return true;
+
+  Timer timer;
+  // ミリ秒への丸めで判定が遅れないよう、経過時間はマイクロ秒で測る
+  uint64_t elapsedTime = timer.elapsedMicro(startTime);
+  double distance = getDistance();
+  bool isTimeout = timeLimit > 0 && elapsedTime >= static_cast<uint64_t>(timeLimit) * 1000;
+  bool isOverDistance = distanceLimit > 0.0 && distance >= distanceLimit;
+  if(!isTimeout && !isOverDistance) return false;
+
+  // 制限を超えたらモータを止め、以降の判定はすべて打ち切りとする
+  expired = true;
+  Controller::stopMotor();
+  Controller::stopArmMotor();
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  snprintf(buf, BUF_SIZE, "Watchdog expired by %s (time: %d/%d[ms], distance: %.1f/%.1f[mm])",
+           isTimeout ? "timeout" : "distance", static_cast<int>(elapsedTime / 1000), timeLimit,
+           distance, distanceLimit);
+  Logger logger;
+  logger.logWarning(buf);
+  return true;
+}
+
+bool MotionWatchdog::hasExpired()
+{
+  return expired;
+}
+
+double MotionWatchdog::getDistance()
+{
+  int rightCount = Measurer::getRightTotalCount() - initRightCount;
+  int leftCount = Measurer::getLeftTotalCount() - initLeftCount;
+  double rightDistance = Mileage::calculateWheelMileage(rightCount);
+  double leftDistance = Mileage::calculateWheelMileage(leftCount);
+  return (fabs(rightDistance) + fabs(leftDistance)) / 2.0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file MotionWatchdog.h
+ * @brief 動作ごとの制限時間・制限距離を監視し、超えたら動作を打ち切らせるクラス
+ * @author KatLab
+ */
+
+#ifndef MOTION_WATCHDOG_H
+#define MOTION_WATCHDOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "Measurer.h"
+#include "Controller.h"
+#include "Mileage.h"
+#include "Timer.h"
+#include "Logger.h"
+
+// 制限を超えたときの動作リストの対処
+enum class WATCHDOG_REACTION {
+  CONTINUE,  // 動作を打ち切り、次の動作に進む
+  ABORT,     // 動作を打ち切り、残りの動作リストも実行しない
+};
+
+class MotionWatchdog {
+ public:
+  MotionWatchdog() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 監視を開始する
+   * @param timeLimit 制限時間[ms](0以下の場合は制限しない)
+   * @param distanceLimit 制限距離[mm](0以下の場合は制限しない)
+   * @note 動作の開始時に呼び出す。前回の監視で制限を超えた記録は破棄する
+   */
+  static void start(int timeLimit, double distanceLimit);
+
+  /**
+   * @brief 監視を終了する
+   * @note 制限を超えた記録はhasExpired()で参照できるよう残す
+   */
+  static void stop();
+
+  /**
+   * @brief 制限を超えたかを判定する
+   * @return true:制限を超えた(動作を打ち切る), false:制限内、または監視していない
+   * @note 一度制限を超えたら、監視を終えるまでtrueを返し続ける(合成動作の後続の動作も打ち切る)
+   * @note 制御ループの各周期で呼び出す。初めて超えたときにモータを止めてログを出す
+   */
+  static bool isExpired();
+
+  /**
+   * @brief 直近の監視で制限を超えたかを取得する(判定はしない)
+   * @return true:制限を超えた, false:制限を超えていない
+   */
+  static bool hasExpired();
+
+  /**
+   * @brief 監視を開始してからの走行距離を取得する
+   * @return 左右の車輪の走行距離の絶対値の平均[mm](その場の回頭も走行距離に含める)
+   */
+  static double getDistance();
+
+ private:
+  static bool isWatching;       // true:監視中
+  static bool expired;          // true:直近の監視で制限を超えた
+  static int timeLimit;         // 制限時間[ms]
+  static double distanceLimit;  // 制限距離[mm]
+  static uint64_t startTime;    // 監視を開始した時刻[us]
+  static int initRightCount;    // 監視を開始したときの起動時からの右モータ角位置
+  static int initLeftCount;     // 監視を開始したときの起動時からの左モータ角位置
+};
+
+#endif
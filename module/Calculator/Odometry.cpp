@@ -0,0 +1,79 @@
+/**
+ * @file Odometry.cpp
+ * @brief 車輪の回転量から走行体の位置と向きを推定するクラス
+ * @author KatLab
+ */
+
+#include "Odometry.h"
+
+Pose Odometry::pose = { 0.0, 0.0, 0.0 };
+bool Odometry::isInitialized = false;
+int Odometry::prevRightCount = 0;
+int Odometry::prevLeftCount = 0;
+
+void Odometry::update()
+{
+  // 動作の切り替えによる角位置の初期化の影響を受けないよう、起動時からの角位置を使う
+  int rightCount = Measurer::getRightTotalCount();
+  int leftCount = Measurer::getLeftTotalCount();
+
+  // 初回は角位置を保持するだけ
+  if(!isInitialized) {
+    prevRightCount = rightCount;
+    prevLeftCount = leftCount;
+    isInitialized = true;
+    return;
+  }
+
+  // 前回の更新からの各車輪の走行距離
+  double rightDistance = Mileage::calculateWheelMileage(rightCount - prevRightCount);
+  double leftDistance = Mileage::calculateWheelMileage(leftCount - prevLeftCount);
+  prevRightCount = rightCount;
+  prevLeftCount = leftCount;
+
+  // 走行体の中心の走行距離と向きの変化量
+  double distance = (rightDistance + leftDistance) / 2.0;
+  double diffTheta = (rightDistance - leftDistance) / TREAD;
+
+  // 変化の途中の向きに進んだとみなして位置を更新する
+  double midTheta = pose.theta + diffTheta / 2.0;
+  pose.x += distance * cos(midTheta);
+  pose.y += distance * sin(midTheta);
+  pose.theta = normalizeAngle(pose.theta + diffTheta);
+}
+
+void Odometry::reset()
+{
+  setPose({ 0.0, 0.0, 0.0 });
+}
+
+void Odometry::setPose(const Pose& _pose)
+{
+  pose = _pose;
+  pose.theta = normalizeAngle(pose.theta);
+  // 次回の更新では設定時からの回転量を使う
+  isInitialized = false;
+  update();
+}
+
+Pose Odometry::getPose()
+{
+  return pose;
+}
+
+double Odometry::calcDistanceTo(double x, double y)
+{
+  return hypot(x - pose.x, y - pose.y);
+}
+
+double Odometry::calcAngleTo(double theta)
+{
+  return normalizeAngle(theta - pose.theta);
+}
+
+double Odometry::normalizeAngle(double angle)
+{
+  while(angle > M_PI) angle -= 2.0 * M_PI;
+  while(angle <= -M_PI) angle += 2.0 * M_PI;
+  return angle;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file Odometry.h
+ * @brief 車輪の回転量から走行体の位置と向きを推定するクラス
+ * @author KatLab
+ */
+
+#ifndef ODOMETRY_H
+#define ODOMETRY_H
+
+#include <cmath>
+#include "Measurer.h"
+#include "Mileage.h"
+#include "SystemInfo.h"
+
+// 走行体の位置と向き
+struct Pose {
+  double x;      // x座標[mm](走行開始時の正面方向が正)
+  double y;      // y座標[mm](走行開始時の左方向が正)
+  double theta;  // 向き[rad](x軸正方向が0、反時計回りが正、-π~π)
+};
+
+class Odometry {
+ public:
+  Odometry() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 前回の更新からの車輪の回転量で位置と向きを更新する
+   * @note 制御周期ごとに呼び出す。Measurer::resetCount()の影響は受けない
+   */
+  static void update();
+
+  /**
+   * @brief 位置と向きを原点に初期化する
+   */
+  static void reset();
+
+  /**
+   * @brief 位置と向きを設定する
+   * @param pose 設定する位置と向き
+   */
+  static void setPose(const Pose& pose);
+
+  /**
+   * @brief 位置と向きを取得する
+   * @return 位置と向き
+   */
+  static Pose getPose();
+
+  /**
+   * @brief 現在の位置から指定座標までの距離を求める
+   * @param x 指定座標のx座標[mm]
+   * @param y 指定座標のy座標[mm]
+   * @return 距離[mm]
+   */
+  static double calcDistanceTo(double x, double y);
+
+  /**
+   * @brief 現在の向きから指定した向きまでの回転角を求める
+   * @param theta 指定する向き[rad]
+   * @return 回転角[rad](反時計回りが正、-π~π)
+   */
+  static double calcAngleTo(double theta);
+
+  /**
+   * @brief 角度を-π~πの範囲に正規化する
+   * @param angle 角度[rad]
+   * @return 正規化した角度[rad]
+   */
+  static double normalizeAngle(double angle);
+
+ private:
+  static Pose pose;
+  static bool isInitialized;  // true:前回の角位置あり, false:未初期化
+  static int prevRightCount;  // 前回更新時の起動時からの右モータ角位置[deg]
+  static int prevLeftCount;   // 前回更新時の起動時からの左モータ角位置[deg]
+};
+
+#endif
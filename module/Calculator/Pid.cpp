@@ -8,52 +8,140 @@
 
 PidGain::PidGain(double _kp, double _ki, double _kd) : kp(_kp), ki(_ki), kd(_kd) {}
 
-Pid::Pid(double _kp, double _ki, double _kd, double _targetValue, double _initDeviation,
-         double _timeConstant)
-  : gain(_kp, _ki, _kd),
+template <typename T>
+BasicPid<T>::BasicPid(T _kp, T _ki, T _kd, T _targetValue, T _initDeviation, T _timeConstant)
+  : kp(_kp),
+    ki(_ki),
+    kd(_kd),
     preDeviation(_initDeviation),
-    integral(0.0),
+    integral(0),
     targetValue(_targetValue),
-    timeConstant(_timeConstant)
+    timeConstant(_timeConstant),
+    integralLimit(0),
+    isOutputLimited(false),
+    outputMin(0),
+    outputMax(0),
+    backCalculationGain(0),
+    filterTimeConstant(0),
+    filteredDifference(0),
+    isFilterInitialized(false)
 {
 }
 
-void Pid::setPidGain(double _kp, double _ki, double _kd)
+template <typename T>
+void BasicPid<T>::setPidGain(T _kp, T _ki, T _kd)
 {
-  gain.kp = _kp;
-  gain.ki = _ki;
-  gain.kd = _kd;
+  kp = _kp;
+  ki = _ki;
+  kd = _kd;
 }
 
-double Pid::calculatePid(double currentValue, double delta)
+template <typename T>
+void BasicPid<T>::setTargetValue(T _targetValue)
 {
-  // delta 周期[ms](デフォルト値0.01[10ms]、省略可)
+  targetValue = _targetValue;
+}
+
+template <typename T>
+void BasicPid<T>::setIntegralLimit(T _integralLimit)
+{
+  integralLimit = _integralLimit;
+  limitIntegral();
+}
+
+template <typename T>
+void BasicPid<T>::setOutputLimit(T _outputMin, T _outputMax, T _backCalculationGain)
+{
+  isOutputLimited = true;
+  outputMin = _outputMin;
+  outputMax = _outputMax;
+  backCalculationGain = _backCalculationGain;
+}
+
+template <typename T>
+void BasicPid<T>::setDerivativeFilter(T _filterTimeConstant)
+{
+  filterTimeConstant = _filterTimeConstant;
+  isFilterInitialized = false;
+}
+
+template <typename T>
+void BasicPid<T>::limitIntegral()
+{
+  if(integralLimit <= T(0)) return;
+  if(integral > integralLimit) {
+    integral = integralLimit;
+  } else if(integral < -integralLimit) {
+    integral = -integralLimit;
+  }
+}
+
+template <typename T>
+T BasicPid<T>::absolute(T value)
+{
+  return value < T(0) ? -value : value;
+}
+
+template <typename T>
+T BasicPid<T>::calculatePid(T currentValue, T delta)
+{
+  // delta 周期[s](デフォルト値0.01[10ms]、省略可)
   // 0除算を避けるために0の場合はデフォルト周期0.01とする
-  if(delta == 0) delta = 0.01;
+  if(delta == T(0)) delta = T(0.01);
   // 現在の偏差を求める(目標値と現在値の差)
-  double currentDeviation = targetValue - currentValue;
+  T currentDeviation = targetValue - currentValue;
   // 積分の処理を行う(前回の誤差上辺、今回の誤差を下辺とする台形の面積を求める)
-  integral += (preDeviation + currentDeviation) * delta / 2;
+  integral += (preDeviation + currentDeviation) * delta / T(2);
+  // 偏差の累積を上限に収める
+  limitIntegral();
   // 微分の処理を行う(偏差の時間(delta)に対する傾きを近似)
-  double difference = (currentDeviation - preDeviation) / delta;
+  T difference = (currentDeviation - preDeviation) / delta;
   // 前回の偏差を更新する
   preDeviation = currentDeviation;
 
+  if(filterTimeConstant > T(0)) {
+    // 偏差の変化率に一次遅れフィルタを適用(後退差分で離散化、初回はそのまま使う)
+    if(isFilterInitialized) {
+      T alpha = delta / (filterTimeConstant + delta);  // 今回の変化率の重み
+      filteredDifference += alpha * (difference - filteredDifference);
+    } else {
+      filteredDifference = difference;
+      isFilterInitialized = true;
+    }
+    difference = filteredDifference;
+  }
+
   // P制御の計算を行う
-  double p = gain.kp * currentDeviation;
+  T p = kp * currentDeviation;
   // I制御の計算を行う
-  double i = gain.ki * integral;
+  T i = ki * integral;
   // D制御の計算を行う
-  double d = gain.kd * difference;
+  T d = kd * difference;
 
-  // 以下の2つの為の条件
+  // 以下の3つの為の条件
+  // 新しい一次遅れフィルタを設定した場合は従来のフィルタを使わない
   // 0除算によるNaN発生を防ぐ
   // 時定数が0の時の無駄な計算を避ける
-  if(timeConstant != 0.0 && gain.kp != 0.0) {
+  if(filterTimeConstant <= T(0) && timeConstant != T(0) && kp != T(0)) {
     // D値に一次遅れフィルタを適用
-    d = d / (1.0 + timeConstant * (fabs(d) / gain.kp));
+    d = d / (T(1) + timeConstant * (absolute(d) / kp));
   }
 
   // 操作量 = P制御 + I制御 + D制御
-  return p + i + d;
-}
\ No newline at end of file
+  T output = p + i + d;
+  if(!isOutputLimited) return output;
+
+  // 操作量を範囲に収め、飽和した分だけ偏差の累積を戻す(バックカリキュレーション)
+  T limitedOutput = output;
+  if(limitedOutput > outputMax) limitedOutput = outputMax;
+  if(limitedOutput < outputMin) limitedOutput = outputMin;
+  if(ki != T(0) && limitedOutput != output) {
+    integral += backCalculationGain * (limitedOutput - output) / ki;
+    limitIntegral();
+  }
+  return limitedOutput;
+}
+
+// 使用する数値型で明示的に実体化する
+template class BasicPid<double>;
+template class BasicPid<Q16_16>;
@@ -8,6 +8,7 @@
 #define PID_H
 
 #include <math.h>
+#include "FixedPoint.h"
 
 // PIDゲインを保持する構造体
 struct PidGain {
@@ -24,7 +25,13 @@ struct PidGain {
   PidGain(double _kp, double _ki, double _kd);
 };
 
-class Pid {
+/**
+ * PIDを計算するクラス
+ * @tparam T 計算に使う数値型(double または FixedPoint)
+ * @note 定義はPid.cppにあり、doubleとQ16_16の2つの型で明示的に実体化する
+ */
+template <typename T>
+class BasicPid {
  public:
   /** コンストラクタ
    * @param _kp Pゲイン
@@ -34,8 +41,7 @@ class Pid {
    * @param _initDeviation 現在の偏差
    * @param _timeConstant 一次遅れフィルタの時定数
    */
-  Pid(double _kp, double _ki, double _kd, double _targetValue, double _initDeviation = 0.0,
-      double _timeConstant = 0.0);
+  BasicPid(T _kp, T _ki, T _kd, T _targetValue, T _initDeviation = T(0), T _timeConstant = T(0));
 
   /**
    * @brief PIDゲインを設定する
@@ -43,22 +49,77 @@ class Pid {
    * @param _ki Iゲイン
    * @param _kd Dゲイン
    */
-  void setPidGain(double _kp, double _ki, double _kd);
+  void setPidGain(T _kp, T _ki, T _kd);
+
+  /**
+   * @brief 目標値を変更する
+   * @param _targetValue 目標値
+   * @note 偏差の累積と前回の偏差は引き継ぐ
+   */
+  void setTargetValue(T _targetValue);
+
+  /**
+   * @brief 偏差の累積の上限を設定する
+   * @param _integralLimit 偏差の累積の絶対値の上限(0以下で上限なし)
+   * @note デフォルトは上限なし
+   */
+  void setIntegralLimit(T _integralLimit);
+
+  /**
+   * @brief 操作量の範囲を設定し、バックカリキュレーション方式のアンチワインドアップを有効にする
+   * @param _outputMin 操作量の下限
+   * @param _outputMax 操作量の上限
+   * @param _backCalculationGain 飽和した分を偏差の累積から差し引く割合(0で差し引かない)
+   * @note デフォルトは操作量を制限しない
+   */
+  void setOutputLimit(T _outputMin, T _outputMax, T _backCalculationGain = T(1));
+
+  /**
+   * @brief D制御に一次遅れフィルタを適用する
+   * @param _filterTimeConstant フィルタの時定数[s](0以下でフィルタなし)
+   * @note 設定するとコンストラクタで渡した時定数による従来のフィルタは使わない
+   */
+  void setDerivativeFilter(T _filterTimeConstant);
 
   /**
    * @brief PIDを計算する
    * @param currentValue 現在値
-   * @param delta 周期[ms](デフォルト値0.01[10ms]、省略可)
+   * @param delta 周期[s](デフォルト値0.01[10ms]、省略可)
    * @return PIDの計算結果(操作量)
    */
-  double calculatePid(double currentValue, double delta = 0.01);
+  T calculatePid(T currentValue, T delta = T(0.01));
 
  private:
-  PidGain gain;
-  double preDeviation;  // 前回の偏差
-  double integral;      // 偏差の累積
-  double targetValue;   // 目標値
-  double timeConstant;  // 一次遅れフィルタの時定数
+  T kp;                      // Pゲイン
+  T ki;                      // Iゲイン
+  T kd;                      // Dゲイン
+  T preDeviation;            // 前回の偏差
+  T integral;                // 偏差の累積
+  T targetValue;             // 目標値
+  T timeConstant;            // 一次遅れフィルタの時定数
+  T integralLimit;           // 偏差の累積の絶対値の上限(0以下で上限なし)
+  bool isOutputLimited;      // true:操作量を制限する, false:制限しない
+  T outputMin;               // 操作量の下限
+  T outputMax;               // 操作量の上限
+  T backCalculationGain;     // 飽和した分を偏差の累積から差し引く割合
+  T filterTimeConstant;      // D制御の一次遅れフィルタの時定数[s](0以下でフィルタなし)
+  T filteredDifference;      // 一次遅れフィルタを通した偏差の変化率
+  bool isFilterInitialized;  // true:filteredDifferenceが有効, false:未計算
+
+  /**
+   * @brief 偏差の累積を上限に収める
+   */
+  void limitIntegral();
+
+  /**
+   * @brief 絶対値を求める
+   * @param value 値
+   * @return 絶対値
+   */
+  static T absolute(T value);
 };
 
+typedef BasicPid<double> Pid;            // 浮動小数点数で計算するPID
+typedef BasicPid<Q16_16> FixedPointPid;  // 固定小数点数で計算するPID
+
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+/**
+ * @file PidGainStore.cpp
+ * @brief 名前をつけたPIDゲインをファイルに保存・読み込みするクラス
+ * @author KatLab
+ */
+
+#include "PidGainStore.h"
+
+using namespace std;
+
+constexpr const char* PidGainStore::DEFAULT_FILE_PATH;
+map<string, PidGain> PidGainStore::gains;
+
+bool PidGainStore::load(const char* filePath)
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  FILE* fp = fopen(filePath, "r");
+  // ゲインファイルがない場合は調整済みのゲインがないものとする
+  if(fp == NULL) return false;
+
+  char row[BUF_SIZE];  // 各行の文字を一時的に保持する領域
+  int loadedCount = 0;
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    char name[BUF_SIZE];
+    double kp, ki, kd;
+    // 「名前,Pゲイン,Iゲイン,Dゲイン」の形式でない行は読み飛ばす
+    if(sscanf(row, "%[^,],%lf,%lf,%lf", name, &kp, &ki, &kd) != 4) continue;
+    setGain(name, PidGain(kp, ki, kd));
+    loadedCount++;
+  }
+  fclose(fp);
+
+  snprintf(buf, BUF_SIZE, "Loaded %d tuned PID gains from '%s'", loadedCount, filePath);
+  logger.log(buf);
+  return true;
+}
+
+bool PidGainStore::save(const char* filePath)
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  FILE* fp = fopen(filePath, "w");
+  if(fp == NULL) {
+    snprintf(buf, BUF_SIZE, "%s file not open!", filePath);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  for(const auto& entry : gains) {
+    fprintf(fp, "%s,%f,%f,%f\n", entry.first.c_str(), entry.second.kp, entry.second.ki,
+            entry.second.kd);
+  }
+  fclose(fp);
+  return true;
+}
+
+void PidGainStore::setGain(const char* name, const PidGain& gain)
+{
+  gains.erase(name);
+  gains.insert(make_pair(string(name), gain));
+}
+
+bool PidGainStore::findGain(const char* name, PidGain& gain)
+{
+  auto it = gains.find(name);
+  if(it == gains.end()) return false;
+  gain = it->second;
+  return true;
+}
+
+void PidGainStore::clear()
+{
+  gains.clear();
+}
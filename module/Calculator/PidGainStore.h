@@ -0,0 +1,63 @@
+/**
+ * @file PidGainStore.h
+ * @brief 名前をつけたPIDゲインをファイルに保存・読み込みするクラス
+ * @author KatLab
+ */
+
+#ifndef PID_GAIN_STORE_H
+#define PID_GAIN_STORE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include "Pid.h"
+#include "Logger.h"
+
+class PidGainStore {
+ public:
+  PidGainStore() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief ゲインファイルからPIDゲインを読み込む
+   * @param filePath ゲインファイルのパス
+   * @return true:読み込めた, false:ファイルがない
+   * @note ファイルの各行は「名前,Pゲイン,Iゲイン,Dゲイン」とし、同じ名前のゲインは上書きする
+   */
+  static bool load(const char* filePath = DEFAULT_FILE_PATH);
+
+  /**
+   * @brief 保持しているPIDゲインをすべてゲインファイルに書き出す
+   * @param filePath ゲインファイルのパス
+   * @return true:書き出せた, false:ファイルを開けない
+   */
+  static bool save(const char* filePath = DEFAULT_FILE_PATH);
+
+  /**
+   * @brief PIDゲインに名前をつけて保持する
+   * @param name 名前(同じ名前のゲインは上書きする)
+   * @param gain PIDゲイン
+   */
+  static void setGain(const char* name, const PidGain& gain);
+
+  /**
+   * @brief 名前からPIDゲインを探す
+   * @param name 名前
+   * @param gain 見つかったPIDゲインを格納する変数
+   * @return true:見つかった, false:見つからない(gainは変更しない)
+   */
+  static bool findGain(const char* name, PidGain& gain);
+
+  /**
+   * @brief 保持しているPIDゲインをすべて破棄する
+   */
+  static void clear();
+
+  static constexpr const char* DEFAULT_FILE_PATH = "etrobocon2023/datafiles/TunedGains.csv";
+
+ private:
+  static std::map<std::string, PidGain> gains;  // 名前とPIDゲインの組
+};
+
+#endif
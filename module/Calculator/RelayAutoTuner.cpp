@@ -0,0 +1,120 @@
+/**
+ * @file RelayAutoTuner.cpp
+ * @brief リレーフィードバック試験でPIDゲインを求めるクラス
+ * @author KatLab
+ */
+
+#include "RelayAutoTuner.h"
+
+RelayAutoTuner::RelayAutoTuner(double _targetValue, double _relayAmplitude, double _hysteresis,
+                               int _skipCycleCount, int _measureCycleCount)
+  : targetValue(_targetValue),
+    relayAmplitude(fabs(_relayAmplitude)),
+    hysteresis(fabs(_hysteresis)),
+    skipCycleCount(_skipCycleCount),
+    measureCycleCount(_measureCycleCount),
+    isOutputPositive(true),
+    isStarted(false),
+    hasRisen(false),
+    prevRiseTime(0),
+    maxValue(0.0),
+    minValue(0.0),
+    cycleCount(0),
+    sumPeriod(0.0),
+    sumAmplitude(0.0),
+    measuredCycleCount(0)
+{
+}
+
+double RelayAutoTuner::update(double currentValue, uint64_t time)
+{
+  double deviation = targetValue - currentValue;
+
+  // 初回は偏差の向きにリレー出力を決める
+  if(!isStarted) {
+    isStarted = true;
+    isOutputPositive = deviation >= 0.0;
+    maxValue = currentValue;
+    minValue = currentValue;
+  }
+
+  // 今の周期の現在値の最大値と最小値を更新する
+  maxValue = fmax(maxValue, currentValue);
+  minValue = fmin(minValue, currentValue);
+
+  // 偏差がヒステリシス幅を超えて反転したらリレー出力を切り替える
+  if(isOutputPositive && deviation < -hysteresis) {
+    isOutputPositive = false;
+  } else if(!isOutputPositive && deviation > hysteresis) {
+    isOutputPositive = true;
+    // 負から正への切り替えの間隔を振動の1周期とする
+    if(hasRisen && !isFinished()) {
+      cycleCount++;
+      if(cycleCount > skipCycleCount) {
+        sumPeriod += static_cast<double>(time - prevRiseTime) / 1000000.0;
+        sumAmplitude += (maxValue - minValue) / 2.0;
+        measuredCycleCount++;
+      }
+    }
+    hasRisen = true;
+    prevRiseTime = time;
+    maxValue = currentValue;
+    minValue = currentValue;
+  }
+
+  return isOutputPositive ? relayAmplitude : -relayAmplitude;
+}
+
+bool RelayAutoTuner::isFinished()
+{
+  return measuredCycleCount >= measureCycleCount;
+}
+
+double RelayAutoTuner::getUltimatePeriod()
+{
+  if(measuredCycleCount == 0) return 0.0;
+  return sumPeriod / measuredCycleCount;
+}
+
+double RelayAutoTuner::getAmplitude()
+{
+  if(measuredCycleCount == 0) return 0.0;
+  return sumAmplitude / measuredCycleCount;
+}
+
+double RelayAutoTuner::getUltimateGain()
+{
+  double amplitude = getAmplitude();
+  // 振幅がヒステリシス幅以下の場合は振動を計測できていない
+  if(amplitude <= hysteresis) return 0.0;
+  // 記述関数法: Ku = 4d / (π * sqrt(a^2 - ε^2))
+  return 4.0 * relayAmplitude / (M_PI * sqrt(amplitude * amplitude - hysteresis * hysteresis));
+}
+
+PidGain RelayAutoTuner::calcGain(double ultimateGain, double ultimatePeriod, TUNING_RULE rule)
+{
+  if(ultimatePeriod <= 0.0) return PidGain(0.0, 0.0, 0.0);
+
+  double kp;  // 比例ゲイン
+  double ti;  // 積分時間[s]
+  double td;  // 微分時間[s]
+  if(rule == TUNING_RULE::TYREUS_LUYBEN) {  // タイリュス・ルイベン法
+    kp = ultimateGain / 2.2;
+    ti = 2.2 * ultimatePeriod;
+    td = ultimatePeriod / 6.3;
+  } else {  // ジーグラ・ニコルス法
+    kp = 0.6 * ultimateGain;
+    ti = 0.5 * ultimatePeriod;
+    td = 0.125 * ultimatePeriod;
+  }
+  return PidGain(kp, kp / ti, kp * td);
+}
+
+const char* RelayAutoTuner::ruleToString(TUNING_RULE rule)
+{
+  if(rule == TUNING_RULE::TYREUS_LUYBEN) {  // タイリュス・ルイベン法の場合
+    return "TL";
+  } else {  // ジーグラ・ニコルス法の場合
+    return "ZN";
+  }
+}
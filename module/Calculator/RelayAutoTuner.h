@@ -0,0 +1,100 @@
+/**
+ * @file RelayAutoTuner.h
+ * @brief リレーフィードバック試験でPIDゲインを求めるクラス
+ * @author KatLab
+ */
+
+#ifndef RELAY_AUTO_TUNER_H
+#define RELAY_AUTO_TUNER_H
+
+#include <stdint.h>
+#include <math.h>
+#include "Pid.h"
+
+// 限界ゲインと限界周期からPIDゲインを求める調整則
+enum class TUNING_RULE {
+  ZIEGLER_NICHOLS,  // ジーグラ・ニコルス法(応答が速く、行き過ぎが大きい)
+  TYREUS_LUYBEN,    // タイリュス・ルイベン法(行き過ぎが小さく、外乱に強い)
+};
+
+class RelayAutoTuner {
+ public:
+  /**
+   * コンストラクタ
+   * @param _targetValue 目標値
+   * @param _relayAmplitude リレー出力(操作量)の大きさ
+   * @param _hysteresis リレーを切り替える偏差の幅(ノイズによる切り替えを防ぐ)
+   * @param _skipCycleCount 計測前に読み飛ばす振動の周期数(過渡応答を除くため)
+   * @param _measureCycleCount 平均をとる振動の周期数
+   */
+  RelayAutoTuner(double _targetValue, double _relayAmplitude, double _hysteresis,
+                 int _skipCycleCount = 2, int _measureCycleCount = 4);
+
+  /**
+   * @brief 現在値からリレー出力を決め、振動の周期と振幅を計測する
+   * @param currentValue 現在値
+   * @param time 現在時刻[us]
+   * @return リレー出力(偏差が正の場合は+_relayAmplitude、負の場合は-_relayAmplitude)
+   * @note 制御周期ごとに呼び出す
+   */
+  double update(double currentValue, uint64_t time);
+
+  /**
+   * @brief 計測が終わったかを判定する
+   * @return true:計測済み, false:計測中
+   */
+  bool isFinished();
+
+  /**
+   * @brief 限界周期を取得する
+   * @return 計測した振動の周期の平均[s](計測前は0)
+   */
+  double getUltimatePeriod();
+
+  /**
+   * @brief 限界ゲインを取得する
+   * @return 記述関数法で求めた限界ゲイン(計測前は0)
+   */
+  double getUltimateGain();
+
+  /**
+   * @brief 計測した振動の振幅を取得する
+   * @return 現在値の振幅の平均(計測前は0)
+   */
+  double getAmplitude();
+
+  /**
+   * @brief 限界ゲインと限界周期から調整則に従ってPIDゲインを求める
+   * @param ultimateGain 限界ゲイン
+   * @param ultimatePeriod 限界周期[s]
+   * @param rule 調整則
+   * @return PIDゲイン(限界周期が0以下の場合は全て0)
+   */
+  static PidGain calcGain(double ultimateGain, double ultimatePeriod, TUNING_RULE rule);
+
+  /**
+   * @brief 調整則を表す文字列を取得する
+   * @param rule 調整則
+   * @return 調整則を表す文字列
+   */
+  static const char* ruleToString(TUNING_RULE rule);
+
+ private:
+  double targetValue;      // 目標値
+  double relayAmplitude;   // リレー出力の大きさ
+  double hysteresis;       // リレーを切り替える偏差の幅
+  int skipCycleCount;      // 読み飛ばす周期数
+  int measureCycleCount;   // 平均をとる周期数
+  bool isOutputPositive;   // true:リレー出力が正, false:負
+  bool isStarted;          // true:1度以上updateを呼び出した, false:未呼び出し
+  bool hasRisen;           // true:リレー出力が負から正に切り替わったことがある, false:ない
+  uint64_t prevRiseTime;   // 前回リレー出力が負から正に切り替わった時刻[us]
+  double maxValue;         // 今の周期の現在値の最大値
+  double minValue;         // 今の周期の現在値の最小値
+  int cycleCount;          // 計測した周期数(読み飛ばした周期を含む)
+  double sumPeriod;        // 平均をとる周期の合計[s]
+  double sumAmplitude;     // 平均をとる振幅の合計
+  int measuredCycleCount;  // 平均をとった周期数
+};
+
+#endif
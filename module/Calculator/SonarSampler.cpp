@@ -0,0 +1,91 @@
+/**
+ * @file SonarSampler.cpp
+ * @brief 超音波センサの距離を一定周期で取得し、フィルタした値を保持するクラス
+ * @author KatLab
+ */
+
+#include "SonarSampler.h"
+// カーネルのサービスコールと、app.cfgから生成される周期通知のID番号
+#include "kernel.h"
+#include "kernel_cfg.h"
+
+int SonarSampler::samples[MEDIAN_SIZE] = {};
+int SonarSampler::sampleCount = 0;
+int SonarSampler::nextIndex = 0;
+int SonarSampler::filteredDistance = NO_OBJECT_DISTANCE;
+uint64_t SonarSampler::sampledTime = 0;
+volatile bool SonarSampler::isStarted = false;
+
+void SonarSampler::start()
+{
+  isStarted = true;
+  sta_cyc(SONAR_CYC);
+}
+
+void SonarSampler::stop()
+{
+  stp_cyc(SONAR_CYC);
+  isStarted = false;
+}
+
+void SonarSampler::sample()
+{
+  Timer timer;
+  // センサへの問い合わせは時間がかかるので、CPUロックの外で行う
+  // Measurerの距離は[cm]なので[mm]に直す
+  int distance = Measurer::getForwardDistance() * 10;
+  uint64_t currentTime = timer.nowMicro();
+
+  // 更新の途中でメインタスクに割り込まれて読まれないよう、CPUロック状態で書き換える
+  loc_cpu();
+  samples[nextIndex] = distance;
+  nextIndex = (nextIndex + 1) % MEDIAN_SIZE;
+  if(sampleCount < MEDIAN_SIZE) sampleCount++;
+
+  // 単発の誤計測(反射の取りこぼしなど)を除くため、直近の計測値の中央値を取る
+  int sorted[MEDIAN_SIZE];
+  for(int i = 0; i < sampleCount; i++) {
+    sorted[i] = samples[i];
+  }
+  std::sort(sorted, sorted + sampleCount);
+  filteredDistance = sorted[sampleCount / 2];
+  sampledTime = currentTime;
+  unl_cpu();
+}
+
+int SonarSampler::getDistance()
+{
+  // 計測タスクを開始する前(キャリブレーション中など)は、古い値しかなければその場で計測する
+  // 開始した後は計測タスクだけが書き換えるので、ここでは計測しない
+  if(!isStarted) {
+    Timer timer;
+    uint64_t currentTime = timer.nowMicro();
+    if(sampleCount == 0 || currentTime < sampledTime || currentTime - sampledTime > STALE_TIME) {
+      sample();
+    }
+  }
+
+  loc_cpu();
+  int distance = filteredDistance;
+  unl_cpu();
+  return distance;
+}
+
+uint64_t SonarSampler::getSampledTime()
+{
+  // 32bitのCPUでは64bitの値を1命令で読めないので、CPUロック状態で読む
+  loc_cpu();
+  uint64_t time = sampledTime;
+  unl_cpu();
+  return time;
+}
+
+void SonarSampler::reset()
+{
+  loc_cpu();
+  sampleCount = 0;
+  nextIndex = 0;
+  filteredDistance = NO_OBJECT_DISTANCE;
+  sampledTime = 0;
+  unl_cpu();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file SonarSampler.h
+ * @brief 超音波センサの距離を一定周期で取得し、フィルタした値を保持するクラス
+ * @author KatLab
+ */
+
+#ifndef SONAR_SAMPLER_H
+#define SONAR_SAMPLER_H
+
+#include <stdint.h>
+#include <algorithm>
+#include "Measurer.h"
+#include "Timer.h"
+
+class SonarSampler {
+ public:
+  SonarSampler() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 計測タスク(app.cfgのSONAR_TASK)の周期的な起動を開始する
+   * @note Measurer::sonarSensorとTimer::clockを設定した後に呼び出す。
+   *       開始した後はgetDistance()から計測せず、計測タスクだけが保持する値を書き換える
+   */
+  static void start();
+
+  /**
+   * @brief 計測タスクの周期的な起動を停止する
+   */
+  static void stop();
+
+  /**
+   * @brief 超音波センサから距離を1回取得し、保持する距離を更新する
+   * @note 実機では計測タスクからSAMPLE_PERIODごとに呼び出される
+   */
+  static void sample();
+
+  /**
+   * @brief 保持している距離を取得する
+   * @return 直近MEDIAN_SIZE回の計測値の中央値[mm](物体を認識していない時はNO_OBJECT_DISTANCE)
+   * @note センサへは問い合わせない。ただし計測タスクを開始しておらず値がSTALE_TIMEより
+   *       古い場合は、その場で1回計測してから返す
+   */
+  static int getDistance();
+
+  /**
+   * @brief 保持している距離を最後に更新した時刻を取得する
+   * @return 最後に更新した時刻[us](1度も計測していない場合は0)
+   */
+  static uint64_t getSampledTime();
+
+  /**
+   * @brief 保持している計測値を破棄する
+   */
+  static void reset();
+
+  static constexpr int MEDIAN_SIZE = 3;             // 中央値を取る計測値の数
+  static constexpr uint64_t SAMPLE_PERIOD = 50000;  // 計測タスクの周期[us]
+  static constexpr uint64_t STALE_TIME = 200000;    // 保持している距離を古いとみなす時間[us]
+  static constexpr int NO_OBJECT_DISTANCE = 10000;  // 物体を認識していない時の距離[mm]
+
+ private:
+  // 以下の計測値はメインタスクと計測タスクから読み書きするため、loc_cpu/unl_cpuの間で扱う
+  static int samples[MEDIAN_SIZE];  // 直近の計測値[mm](リングバッファ)
+  static int sampleCount;           // 保持している計測値の数
+  static int nextIndex;             // 次に計測値を書き込む位置
+  static int filteredDistance;      // フィルタした距離[mm]
+  static uint64_t sampledTime;      // 最後に更新した時刻[us]
+  static volatile bool isStarted;   // true:計測タスクを開始した, false:開始していない
+};
+
+#endif
@@ -8,16 +8,14 @@
 SpeedCalculator::SpeedCalculator(double _targetSpeed)
   : rightTargetSpeed(_targetSpeed),
     leftTargetSpeed(_targetSpeed),
-    rightPid(K_P, K_I, K_D, _targetSpeed, 0.0),
-    leftPid(K_P, K_I, K_D, _targetSpeed, 0.0)
+    rightPid(K_P, K_I, K_D, _targetSpeed, _targetSpeed - estimateRightSpeed()),
+    leftPid(K_P, K_I, K_D, _targetSpeed, _targetSpeed - estimateLeftSpeed()),
+    rightFeedforwardPwm(calcRightFeedforwardPwm(_targetSpeed)),
+    leftFeedforwardPwm(calcLeftFeedforwardPwm(_targetSpeed)),
+    rightCorrectionPwm(0.0),
+    leftCorrectionPwm(0.0)
 {
-  rightPwm = Controller::getRightPwm();
-  leftPwm = Controller::getLeftPwm();
-  int rightAngle = Measurer::getRightCount();
-  int leftAngle = Measurer::getLeftCount();
-  prevRightMileage = Mileage::calculateWheelMileage(rightAngle);
-  prevLeftMileage = Mileage::calculateWheelMileage(leftAngle);
-  int currentTime = timer.now();
+  uint64_t currentTime = timer.nowMicro();
   prevRightTime = currentTime;
   prevLeftTime = currentTime;
 }
@@ -25,67 +23,125 @@ SpeedCalculator::SpeedCalculator(double _targetSpeed)
 SpeedCalculator::SpeedCalculator(double _rightTargetSpeed, double _leftTargetSpeed)
   : rightTargetSpeed(_rightTargetSpeed),
     leftTargetSpeed(_leftTargetSpeed),
-    rightPid(R_K_P, R_K_I, R_K_D, _rightTargetSpeed, 0.0),
-    leftPid(R_K_P, R_K_I, R_K_D, _leftTargetSpeed, 0.0)
+    rightPid(R_K_P, R_K_I, R_K_D, _rightTargetSpeed, _rightTargetSpeed - estimateRightSpeed()),
+    leftPid(R_K_P, R_K_I, R_K_D, _leftTargetSpeed, _leftTargetSpeed - estimateLeftSpeed()),
+    rightFeedforwardPwm(calcRightFeedforwardPwm(_rightTargetSpeed)),
+    leftFeedforwardPwm(calcLeftFeedforwardPwm(_leftTargetSpeed)),
+    rightCorrectionPwm(0.0),
+    leftCorrectionPwm(0.0)
 {
-  rightPwm = Controller::getRightPwm();
-  leftPwm = Controller::getLeftPwm();
-  int rightAngle = Measurer::getRightCount();
-  int leftAngle = Measurer::getLeftCount();
-  prevRightMileage = Mileage::calculateWheelMileage(rightAngle);
-  prevLeftMileage = Mileage::calculateWheelMileage(leftAngle);
-  int currentTime = timer.now();
+  uint64_t currentTime = timer.nowMicro();
   prevRightTime = currentTime;
   prevLeftTime = currentTime;
 }
 
 double SpeedCalculator::calcRightPwmFromSpeed()
 {
-  // 右タイヤの回転角度を取得
-  int rightAngle = Measurer::getRightCount();
-  // 右タイヤの走行距離を算出
-  double currentRightMileage = Mileage::calculateWheelMileage(rightAngle);
-  double diffRightMileage = currentRightMileage - prevRightMileage;
-  // 走行時間を算出
-  int currentRightTime = timer.now();
-  double diffRightTime = (double)(currentRightTime - prevRightTime);
-  // 右タイヤの走行速度を算出
-  double currentRightSpeed = calcSpeed(diffRightMileage, diffRightTime);
-  // 走行速度に相当する右タイヤのPWM値を算出
-  rightPwm += rightPid.calculatePid(currentRightSpeed, diffRightTime);
+  // 目標速度が0のとき、0を返す
+  if(rightTargetSpeed == 0.0) return 0.0;
+  // 右タイヤの走行速度を推定する
+  double currentRightSpeed = estimateRightSpeed();
+  // 前回の算出からの経過時間[s]を算出
+  uint64_t currentRightTime = timer.nowMicro();
+  double diffRightTime = static_cast<double>(currentRightTime - prevRightTime) / 1000000.0;
+  // 目標速度とのずれをPIDで補正する
+  rightCorrectionPwm += rightPid.calculatePid(currentRightSpeed, diffRightTime);
+  // モータのPWM値の範囲を超えた分は補正値に積み上げない(ワインドアップ対策)
+  rightCorrectionPwm = limitCorrectionPwm(rightCorrectionPwm, rightFeedforwardPwm);
   // メンバを更新
-  prevRightMileage = currentRightMileage;
   prevRightTime = currentRightTime;
 
-  return rightPwm;
+  // 走行速度に相当する右タイヤのPWM値 = フィードフォワード値 + 補正値
+  return rightFeedforwardPwm + rightCorrectionPwm;
 }
 
 double SpeedCalculator::calcLeftPwmFromSpeed()
 {
-  // 左タイヤの回転角度を取得
-  int leftAngle = Measurer::getLeftCount();
-  // 左タイヤの走行距離を算出
-  double currentLeftMileage = Mileage::calculateWheelMileage(leftAngle);
-  double diffLeftMileage = currentLeftMileage - prevLeftMileage;
-  // 走行時間を算出
-  int currentLeftTime = timer.now();
-  double diffLeftTime = (double)(currentLeftTime - prevLeftTime);
-  // 左タイヤの走行速度を算出
-  double currentLeftSpeed = calcSpeed(diffLeftMileage, diffLeftTime);
-  // 走行速度に相当する左タイヤのPWM値を算出
-  leftPwm += leftPid.calculatePid(currentLeftSpeed, diffLeftTime);
+  // 目標速度が0のとき、0を返す
+  if(leftTargetSpeed == 0.0) return 0.0;
+  // 左タイヤの走行速度を推定する
+  double currentLeftSpeed = estimateLeftSpeed();
+  // 前回の算出からの経過時間[s]を算出
+  uint64_t currentLeftTime = timer.nowMicro();
+  double diffLeftTime = static_cast<double>(currentLeftTime - prevLeftTime) / 1000000.0;
+  // 目標速度とのずれをPIDで補正する
+  leftCorrectionPwm += leftPid.calculatePid(currentLeftSpeed, diffLeftTime);
+  // モータのPWM値の範囲を超えた分は補正値に積み上げない(ワインドアップ対策)
+  leftCorrectionPwm = limitCorrectionPwm(leftCorrectionPwm, leftFeedforwardPwm);
   // メンバを更新
-  prevLeftMileage = currentLeftMileage;
   prevLeftTime = currentLeftTime;
 
-  return leftPwm;
+  // 走行速度に相当する左タイヤのPWM値 = フィードフォワード値 + 補正値
+  return leftFeedforwardPwm + leftCorrectionPwm;
 }
 
-double SpeedCalculator::calcSpeed(double diffMileage, double diffTime)
+void SpeedCalculator::setTargetSpeed(double _targetSpeed)
 {
-  // 走行時間が0のとき、0を返す
-  if(diffTime == 0.0) return 0.0;
-  // 走行速度[mm/s]を算出(= 1000 * mm / ms)
-  double speed = 1000 * diffMileage / diffTime;
-  return speed;
+  rightTargetSpeed = _targetSpeed;
+  leftTargetSpeed = _targetSpeed;
+  rightPid.setTargetValue(_targetSpeed);
+  leftPid.setTargetValue(_targetSpeed);
+  rightFeedforwardPwm = calcRightFeedforwardPwm(_targetSpeed);
+  leftFeedforwardPwm = calcLeftFeedforwardPwm(_targetSpeed);
+}
+
+double SpeedCalculator::calcRightFeedforwardPwm(double speed)
+{
+  FeedforwardParam param = FeedforwardModel::getRight();
+  return calcFeedforwardPwm(speed, param.deadbandPwm, param.slope);
+}
+
+double SpeedCalculator::calcLeftFeedforwardPwm(double speed)
+{
+  FeedforwardParam param = FeedforwardModel::getLeft();
+  return calcFeedforwardPwm(speed, param.deadbandPwm, param.slope);
+}
+
+double SpeedCalculator::calcFeedforwardPwm(double speed, double deadbandPwm, double slope)
+{
+  // 走行速度が0のとき、0を返す
+  if(speed == 0.0) return 0.0;
+  // 不感帯の分を上乗せし、走行速度の向きに合わせて符号をつける
+  double pwm = deadbandPwm + slope * fabs(speed);
+  return speed > 0.0 ? pwm : -pwm;
+}
+
+double SpeedCalculator::calcRightFeedforwardSpeed(double pwm)
+{
+  FeedforwardParam param = FeedforwardModel::getRight();
+  return calcFeedforwardSpeed(pwm, param.deadbandPwm, param.slope);
+}
+
+double SpeedCalculator::calcLeftFeedforwardSpeed(double pwm)
+{
+  FeedforwardParam param = FeedforwardModel::getLeft();
+  return calcFeedforwardSpeed(pwm, param.deadbandPwm, param.slope);
+}
+
+double SpeedCalculator::calcFeedforwardSpeed(double pwm, double deadbandPwm, double slope)
+{
+  // 不感帯内のPWM値では車輪は回らない
+  if(fabs(pwm) <= deadbandPwm) return 0.0;
+  // 不感帯の分を差し引き、PWM値の向きに合わせて符号をつける
+  double speed = (fabs(pwm) - deadbandPwm) / slope;
+  return pwm > 0.0 ? speed : -speed;
+}
+
+double SpeedCalculator::limitCorrectionPwm(double correctionPwm, double feedforwardPwm)
+{
+  double maxCorrectionPwm = Controller::MOTOR_PWM_MAX - feedforwardPwm;
+  double minCorrectionPwm = Controller::MOTOR_PWM_MIN - feedforwardPwm;
+  return std::max(std::min(correctionPwm, maxCorrectionPwm), minCorrectionPwm);
+}
+
+double SpeedCalculator::estimateRightSpeed()
+{
+  SpeedEstimator::update();
+  return SpeedEstimator::getRightSpeed();
+}
+
+double SpeedCalculator::estimateLeftSpeed()
+{
+  SpeedEstimator::update();
+  return SpeedEstimator::getLeftSpeed();
 }
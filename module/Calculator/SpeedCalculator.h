@@ -7,11 +7,14 @@
 #ifndef SPEED_CALCULATOR_H
 #define SPEED_CALCULATOR_H
 
+#include <algorithm>
 #include "Measurer.h"
 #include "Controller.h"
 #include "Mileage.h"
 #include "Pid.h"
 #include "Timer.h"
+#include "SpeedEstimator.h"
+#include "FeedforwardModel.h"
 
 class SpeedCalculator {
  public:
@@ -40,34 +43,99 @@ class SpeedCalculator {
    */
   double calcLeftPwmFromSpeed();
 
+  /**
+   * @brief 左右の車輪の目標とする走行速度を変更する
+   * @param _targetSpeed 目標とする走行速度[mm/s]
+   * @note PIDによる補正値は引き継ぐ
+   */
+  void setTargetSpeed(double _targetSpeed);
+
+  /**
+   * @brief 走行速度に相当する右車輪のフィードフォワードPWM値を算出する
+   * @param speed 走行速度[mm/s]
+   * @return 走行速度に相当する右タイヤのPWM値(速度が0の場合は0)
+   */
+  static double calcRightFeedforwardPwm(double speed);
+
+  /**
+   * @brief 走行速度に相当する左車輪のフィードフォワードPWM値を算出する
+   * @param speed 走行速度[mm/s]
+   * @return 走行速度に相当する左タイヤのPWM値(速度が0の場合は0)
+   */
+  static double calcLeftFeedforwardPwm(double speed);
+
+  /**
+   * @brief PWM値から見込まれる右車輪の走行速度をフィードフォワードモデルの逆算で求める
+   * @param pwm 右タイヤのPWM値
+   * @return 見込まれる右タイヤの走行速度[mm/s](不感帯内の場合は0)
+   */
+  static double calcRightFeedforwardSpeed(double pwm);
+
+  /**
+   * @brief PWM値から見込まれる左車輪の走行速度をフィードフォワードモデルの逆算で求める
+   * @param pwm 左タイヤのPWM値
+   * @return 見込まれる左タイヤの走行速度[mm/s](不感帯内の場合は0)
+   */
+  static double calcLeftFeedforwardSpeed(double pwm);
+
  private:
-  const double rightTargetSpeed;
-  const double leftTargetSpeed;
+  double rightTargetSpeed;
+  double leftTargetSpeed;
   Pid rightPid;
   Pid leftPid;
   Timer timer;
-  double rightPwm;
-  double leftPwm;
-  double prevRightMileage;
-  double prevLeftMileage;
-  int prevRightTime;
-  int prevLeftTime;
-  // 回頭以外のPIDゲイン
+  double rightFeedforwardPwm;  // 目標速度に相当する右タイヤのPWM値
+  double leftFeedforwardPwm;   // 目標速度に相当する左タイヤのPWM値
+  double rightCorrectionPwm;   // PIDで補正する右タイヤのPWM値
+  double leftCorrectionPwm;    // PIDで補正する左タイヤのPWM値
+  uint64_t prevRightTime;      // 前回右タイヤのPWM値を算出した時刻[us]
+  uint64_t prevLeftTime;       // 前回左タイヤのPWM値を算出した時刻[us]
+  // 回頭以外のPIDゲイン(PIDに渡す周期の単位は[s])
   static constexpr double K_P = 0.004;
-  static constexpr double K_I = 0.0000005;
-  static constexpr double K_D = 0.0007;
-  // 回頭用PIDゲイン
+  static constexpr double K_I = 0.0005;
+  static constexpr double K_D = 0.0000007;
+  // 回頭用PIDゲイン(PIDに渡す周期の単位は[s])
   // ToDo：次イテレーションで調整
   static constexpr double R_K_P = 0.004;
-  static constexpr double R_K_I = 0.0000005;
-  static constexpr double R_K_D = 0.0007;
+  static constexpr double R_K_I = 0.0005;
+  static constexpr double R_K_D = 0.0000007;
+
+  /**
+   * @brief 走行速度の推定値を更新し、右タイヤの走行速度を取得する
+   * @return 右タイヤの走行速度[mm/s]
+   */
+  static double estimateRightSpeed();
+
+  /**
+   * @brief 走行速度の推定値を更新し、左タイヤの走行速度を取得する
+   * @return 左タイヤの走行速度[mm/s]
+   */
+  static double estimateLeftSpeed();
+
+  /**
+   * @brief 不感帯と傾きから走行速度に相当するPWM値を算出する
+   * @param speed 走行速度[mm/s]
+   * @param deadbandPwm 車輪が回り始めるPWM値
+   * @param slope 速度あたりのPWM値[1/(mm/s)]
+   * @return 走行速度に相当するPWM値
+   */
+  static double calcFeedforwardPwm(double speed, double deadbandPwm, double slope);
+
+  /**
+   * @brief 不感帯と傾きからPWM値に相当する走行速度を算出する
+   * @param pwm PWM値
+   * @param deadbandPwm 車輪が回り始めるPWM値
+   * @param slope 速度あたりのPWM値[1/(mm/s)]
+   * @return PWM値に相当する走行速度[mm/s]
+   */
+  static double calcFeedforwardSpeed(double pwm, double deadbandPwm, double slope);
 
   /**
-   * @brief 走行速度を算出する
-   * @param diffMileage 移動距離[mm]
-   * @param diffTime 移動時間[ms]
-   * @return 走行速度[mm/s]
+   * @brief フィードフォワード値との和がモータのPWM値の範囲に収まるよう補正値を制限する
+   * @param correctionPwm 補正値
+   * @param feedforwardPwm フィードフォワード値
+   * @return 制限した補正値
    */
-  double calcSpeed(double diffMileage, double diffTime);
+  static double limitCorrectionPwm(double correctionPwm, double feedforwardPwm);
 };
 #endif
\ No newline at end of file
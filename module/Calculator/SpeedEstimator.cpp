@@ -0,0 +1,90 @@
+/**
+ * @file SpeedEstimator.cpp
+ * @brief 車輪の走行速度と加速度を推定するクラス
+ * @author KatLab
+ */
+
+#include "SpeedEstimator.h"
+
+WheelState SpeedEstimator::rightState = { 0.0, 0.0, 0.0 };
+WheelState SpeedEstimator::leftState = { 0.0, 0.0, 0.0 };
+bool SpeedEstimator::isInitialized = false;
+uint64_t SpeedEstimator::updatedTime = 0;
+
+void SpeedEstimator::update()
+{
+  Timer timer;
+  uint64_t currentTime = timer.nowMicro();
+
+  // 同じ制御周期内の呼び出しは無視する
+  if(isInitialized && currentTime >= updatedTime
+     && currentTime - updatedTime < MIN_UPDATE_INTERVAL) {
+    return;
+  }
+
+  // 動作の切り替えによる角位置の初期化の影響を受けないよう、起動時からの角位置を使う
+  double rightPosition = Mileage::calculateWheelMileage(Measurer::getRightTotalCount());
+  double leftPosition = Mileage::calculateWheelMileage(Measurer::getLeftTotalCount());
+
+  // 初回、または時刻が戻った・間隔が空きすぎた場合は計測値で初期化する
+  if(!isInitialized || currentTime < updatedTime
+     || currentTime - updatedTime > MAX_UPDATE_INTERVAL) {
+    rightState = { rightPosition, 0.0, 0.0 };
+    leftState = { leftPosition, 0.0, 0.0 };
+    isInitialized = true;
+    updatedTime = currentTime;
+    return;
+  }
+
+  double dt = static_cast<double>(currentTime - updatedTime) / 1000000.0;
+  updateState(rightState, rightPosition, dt);
+  updateState(leftState, leftPosition, dt);
+  updatedTime = currentTime;
+}
+
+void SpeedEstimator::reset()
+{
+  rightState = { 0.0, 0.0, 0.0 };
+  leftState = { 0.0, 0.0, 0.0 };
+  isInitialized = false;
+  updatedTime = 0;
+}
+
+double SpeedEstimator::getRightSpeed()
+{
+  return rightState.speed;
+}
+
+double SpeedEstimator::getLeftSpeed()
+{
+  return leftState.speed;
+}
+
+double SpeedEstimator::getRightAcceleration()
+{
+  return rightState.acceleration;
+}
+
+double SpeedEstimator::getLeftAcceleration()
+{
+  return leftState.acceleration;
+}
+
+uint64_t SpeedEstimator::getUpdatedTime()
+{
+  return updatedTime;
+}
+
+void SpeedEstimator::updateState(WheelState& state, double measuredPosition, double dt)
+{
+  // 前回の推定値から現在の状態を予測する
+  double predictedPosition
+      = state.position + state.speed * dt + 0.5 * state.acceleration * dt * dt;
+  double predictedSpeed = state.speed + state.acceleration * dt;
+
+  // 予測と計測のずれで推定値を補正する
+  double residual = measuredPosition - predictedPosition;
+  state.position = predictedPosition + ALPHA * residual;
+  state.speed = predictedSpeed + BETA * residual / dt;
+  state.acceleration += 2.0 * GAMMA * residual / (dt * dt);
+}
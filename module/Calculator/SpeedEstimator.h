@@ -0,0 +1,90 @@
+/**
+ * @file SpeedEstimator.h
+ * @brief 車輪の走行速度と加速度を推定するクラス
+ * @author KatLab
+ */
+
+#ifndef SPEED_ESTIMATOR_H
+#define SPEED_ESTIMATOR_H
+
+#include <stdint.h>
+#include "Measurer.h"
+#include "Mileage.h"
+#include "Timer.h"
+
+// 1車輪分の推定状態
+struct WheelState {
+  double position;      // 推定走行距離[mm]
+  double speed;         // 推定走行速度[mm/s]
+  double acceleration;  // 推定加速度[mm/s^2]
+};
+
+class SpeedEstimator {
+ public:
+  SpeedEstimator() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief モータ角位置を取得し、推定値を更新する
+   * @note 前回の更新からMIN_UPDATE_INTERVAL未満の呼び出しは無視するため、
+   *       同じ制御周期内で複数回呼び出してもよい
+   */
+  static void update();
+
+  /**
+   * @brief 推定値を破棄する(次回の更新で初期化する)
+   */
+  static void reset();
+
+  /**
+   * @brief 右車輪の推定走行速度を取得する
+   * @return 右車輪の走行速度[mm/s]
+   */
+  static double getRightSpeed();
+
+  /**
+   * @brief 左車輪の推定走行速度を取得する
+   * @return 左車輪の走行速度[mm/s]
+   */
+  static double getLeftSpeed();
+
+  /**
+   * @brief 右車輪の推定加速度を取得する
+   * @return 右車輪の加速度[mm/s^2]
+   */
+  static double getRightAcceleration();
+
+  /**
+   * @brief 左車輪の推定加速度を取得する
+   * @return 左車輪の加速度[mm/s^2]
+   */
+  static double getLeftAcceleration();
+
+  /**
+   * @brief 最後に推定値を更新した時刻を取得する
+   * @return 更新時刻[us]
+   */
+  static uint64_t getUpdatedTime();
+
+  static constexpr uint64_t MIN_UPDATE_INTERVAL = 1000;   // 更新の最小間隔[us]
+  static constexpr uint64_t MAX_UPDATE_INTERVAL = 200000;  // これより間隔が空くと初期化する[us]
+
+ private:
+  // alpha-beta-gammaフィルタのゲイン
+  static constexpr double ALPHA = 0.5;
+  static constexpr double BETA = 0.2;
+  static constexpr double GAMMA = 0.02;
+  static WheelState rightState;
+  static WheelState leftState;
+  static bool isInitialized;  // true:推定値あり, false:未初期化
+  static uint64_t updatedTime;
+
+  /**
+   * @brief 1車輪分の推定値を更新する
+   * @param state 更新する推定状態
+   * @param measuredPosition 計測した走行距離[mm]
+   * @param dt 前回の更新からの経過時間[s]
+   */
+  static void updateState(WheelState& state, double measuredPosition, double dt);
+};
+
+#endif
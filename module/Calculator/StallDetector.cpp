@@ -0,0 +1,118 @@
+/**
+ * @file StallDetector.cpp
+ * @brief 指令したPWM値と車輪の走行速度から車輪の拘束(ストール)と空転(スリップ)を検知するクラス
+ * @author KatLab
+ */
+
+#include "StallDetector.h"
+
+StallDetector::StallDetector()
+  : isStalling(false),
+    isSlipping(false),
+    isStallReported(false),
+    isSlipReported(false),
+    stallStartTime(0),
+    slipStartTime(0),
+    lastAnomaly(DRIVE_ANOMALY::NONE),
+    lastAnomalyTime(0)
+{
+}
+
+DRIVE_ANOMALY StallDetector::update(double rightPwm, double leftPwm)
+{
+  // 走行速度の推定値を更新する
+  SpeedEstimator::update();
+  uint64_t currentTime = SpeedEstimator::getUpdatedTime();
+  double rightSpeed = SpeedEstimator::getRightSpeed();
+  double leftSpeed = SpeedEstimator::getLeftSpeed();
+
+  // モータに指令できるPWM値の範囲に収める
+  rightPwm = std::max(std::min(rightPwm, MAX_PWM), -MAX_PWM);
+  leftPwm = std::max(std::min(leftPwm, MAX_PWM), -MAX_PWM);
+
+  // PWM値から見込まれる走行速度
+  double rightExpectedSpeed = SpeedCalculator::calcRightFeedforwardSpeed(rightPwm);
+  double leftExpectedSpeed = SpeedCalculator::calcLeftFeedforwardSpeed(leftPwm);
+
+  // どちらかの車輪に疑いがあれば継続時間を計り始める
+  bool stalling = isWheelStalling(rightPwm, rightExpectedSpeed, rightSpeed)
+                  || isWheelStalling(leftPwm, leftExpectedSpeed, leftSpeed);
+  bool slipping = isWheelSlipping(rightExpectedSpeed, rightSpeed)
+                  || isWheelSlipping(leftExpectedSpeed, leftSpeed);
+
+  if(!stalling) {
+    isStalling = false;
+    isStallReported = false;
+  } else if(!isStalling) {
+    isStalling = true;
+    stallStartTime = currentTime;
+  }
+
+  if(!slipping) {
+    isSlipping = false;
+    isSlipReported = false;
+  } else if(!isSlipping) {
+    isSlipping = true;
+    slipStartTime = currentTime;
+  }
+
+  // 疑いが継続時間を超えて続いたら異常として確定する
+  if(isStalling && !isStallReported && currentTime - stallStartTime >= STALL_DURATION) {
+    isStallReported = true;
+    lastAnomaly = DRIVE_ANOMALY::STALL;
+    lastAnomalyTime = currentTime;
+    return DRIVE_ANOMALY::STALL;
+  }
+  if(isSlipping && !isSlipReported && currentTime - slipStartTime >= SLIP_DURATION) {
+    isSlipReported = true;
+    lastAnomaly = DRIVE_ANOMALY::SLIP;
+    lastAnomalyTime = currentTime;
+    return DRIVE_ANOMALY::SLIP;
+  }
+
+  return DRIVE_ANOMALY::NONE;
+}
+
+void StallDetector::reset()
+{
+  isStalling = false;
+  isSlipping = false;
+  isStallReported = false;
+  isSlipReported = false;
+}
+
+DRIVE_ANOMALY StallDetector::getLastAnomaly()
+{
+  return lastAnomaly;
+}
+
+uint64_t StallDetector::getLastAnomalyTime()
+{
+  return lastAnomalyTime;
+}
+
+const char* StallDetector::anomalyToString(DRIVE_ANOMALY anomaly)
+{
+  if(anomaly == DRIVE_ANOMALY::STALL) {  // STALLの場合
+    return "STALL";
+  } else if(anomaly == DRIVE_ANOMALY::SLIP) {  // SLIPの場合
+    return "SLIP";
+  } else {  // 異常がない場合
+    return "NONE";
+  }
+}
+
+bool StallDetector::isWheelStalling(double pwm, double expectedSpeed, double speed)
+{
+  // PWM値が小さい間は車輪が止まっていても異常としない
+  if(fabs(pwm) < STALL_MIN_PWM) return false;
+  // 指令した向きに見込みより大幅に遅い(逆向きに回っている場合を含む)
+  double forwardSpeed = expectedSpeed > 0.0 ? speed : -speed;
+  return forwardSpeed < fabs(expectedSpeed) * STALL_SPEED_RATIO;
+}
+
+bool StallDetector::isWheelSlipping(double expectedSpeed, double speed)
+{
+  // 見込みより大幅に速く回っている
+  return fabs(speed) > fabs(expectedSpeed) * SLIP_SPEED_RATIO + SLIP_SPEED_MARGIN;
+}
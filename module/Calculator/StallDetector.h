@@ -0,0 +1,105 @@
+/**
+ * @file StallDetector.h
+ * @brief 指令したPWM値と車輪の走行速度から車輪の拘束(ストール)と空転(スリップ)を検知するクラス
+ * @author KatLab
+ */
+
+#ifndef STALL_DETECTOR_H
+#define STALL_DETECTOR_H
+
+#include <stdint.h>
+#include <algorithm>
+#include "SpeedEstimator.h"
+#include "SpeedCalculator.h"
+
+// 走行中に検知する異常
+enum class DRIVE_ANOMALY {
+  NONE,   // 異常なし
+  STALL,  // 障害物に当たるなどして、PWM値に対して車輪が回らない
+  SLIP,   // 車輪が浮くなどして、PWM値に対して車輪が回りすぎる
+};
+
+// 異常を検知したときの動作の対処
+enum class ANOMALY_REACTION {
+  CONTINUE,  // ログを出して動作を続ける
+  ABORT,     // 動作を打ち切る
+  RETRY,     // モータを止めて待機した後に動作を再開する(上限回数を超えると打ち切る)
+};
+
+class StallDetector {
+ public:
+  /**
+   * コンストラクタ
+   */
+  StallDetector();
+
+  /**
+   * @brief 指令したPWM値と推定走行速度を比べ、異常を判定する
+   * @param rightPwm 右タイヤに指令したPWM値
+   * @param leftPwm 左タイヤに指令したPWM値
+   * @return 新たに確定した異常(確定済みの異常が続いている間はNONE)
+   * @note 制御周期ごとに呼び出す。異常が継続時間を超えて続いたときに1度だけ返す
+   */
+  DRIVE_ANOMALY update(double rightPwm, double leftPwm);
+
+  /**
+   * @brief 判定の途中経過を破棄する
+   */
+  void reset();
+
+  /**
+   * @brief 最後に確定した異常を取得する
+   * @return 最後に確定した異常(確定したことがない場合はNONE)
+   */
+  DRIVE_ANOMALY getLastAnomaly();
+
+  /**
+   * @brief 最後に異常が確定した時刻を取得する
+   * @return 異常が確定した時刻[us]
+   */
+  uint64_t getLastAnomalyTime();
+
+  /**
+   * @brief 異常を表す文字列を取得する
+   * @param anomaly 異常
+   * @return 異常を表す文字列
+   */
+  static const char* anomalyToString(DRIVE_ANOMALY anomaly);
+
+  static constexpr double MAX_PWM = 100.0;            // モータに指令できるPWM値の上限
+  static constexpr double STALL_MIN_PWM = 30.0;       // ストールを判定するPWM値の下限
+  static constexpr double STALL_SPEED_RATIO = 0.2;    // 見込み速度に対してストールとみなす比率
+  static constexpr uint64_t STALL_DURATION = 300000;  // ストールが確定する継続時間[us]
+  static constexpr double SLIP_SPEED_RATIO = 2.0;     // 見込み速度に対してスリップとみなす比率
+  static constexpr double SLIP_SPEED_MARGIN = 100.0;  // スリップとみなす速度の余裕[mm/s]
+  static constexpr uint64_t SLIP_DURATION = 200000;   // スリップが確定する継続時間[us]
+
+ private:
+  bool isStalling;            // true:ストールの疑いが続いている, false:続いていない
+  bool isSlipping;            // true:スリップの疑いが続いている, false:続いていない
+  bool isStallReported;       // true:継続中のストールを確定済み, false:未確定
+  bool isSlipReported;        // true:継続中のスリップを確定済み, false:未確定
+  uint64_t stallStartTime;    // ストールの疑いが始まった時刻[us]
+  uint64_t slipStartTime;     // スリップの疑いが始まった時刻[us]
+  DRIVE_ANOMALY lastAnomaly;  // 最後に確定した異常
+  uint64_t lastAnomalyTime;   // 最後に異常が確定した時刻[us]
+
+  /**
+   * @brief 1車輪がストールの疑いのある状態か判定する
+   * @param pwm 指令したPWM値
+   * @param expectedSpeed PWM値から見込まれる走行速度[mm/s]
+   * @param speed 推定走行速度[mm/s]
+   * @return true:疑いあり, false:疑いなし
+   */
+  static bool isWheelStalling(double pwm, double expectedSpeed, double speed);
+
+  /**
+   * @brief 1車輪がスリップの疑いのある状態か判定する
+   * @param expectedSpeed PWM値から見込まれる走行速度[mm/s]
+   * @param speed 推定走行速度[mm/s]
+   * @return true:疑いあり, false:疑いなし
+   */
+  static bool isWheelSlipping(double expectedSpeed, double speed);
+};
+
+#endif
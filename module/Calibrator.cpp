@@ -6,20 +6,80 @@
 
 #include "Calibrator.h"
 
-Calibrator::Calibrator() : isLeftCourse(true), targetBrightness(50) {}
+constexpr const char* Calibrator::DEFAULT_PROFILE_PATH;
+
+Calibrator::Calibrator(const char* _profilePath, const char* _transferPath)
+  : isLeftCourse(true),
+    targetBrightness(50),
+    profile({ true, 0, 100, 50, { 0, 0, 0 }, { 255, 255, 255 }, 0 }),
+    profilePath(_profilePath),
+    transferPath(_transferPath)
+{
+}
 
 void Calibrator::run()
 {
-  //  画像の削除
-  char cmd[256];
-  snprintf(cmd, 256, "cd etrobocon2023/rear_camera_py && make rm-img && cd ../..");
-  system(cmd);
+  // 保存されたキャリブレーション結果を再利用する場合は測定を省く
+  if(profilePath != nullptr && loadProfile(profilePath, profile) && acceptCachedProfile()) {
+    // 前回ラインを横切って求めた変換表があれば線形化に使う
+    if(transferPath != nullptr && !BrightnessLinearizer::load(transferPath)) {
+      BrightnessLinearizer::clear();
+    }
+    return;
+  }
 
   // 左右ボタンでコースのLRを選択する
   selectCourse();
 
   // 目標輝度を測定する
   measureTargetBrightness();
+
+  // 次回の起動時に再利用できるよう測定結果を保存する
+  if(profilePath != nullptr) {
+    profile.timestamp = static_cast<long>(time(NULL));
+    saveProfile(profilePath, profile);
+  }
+}
+
+bool Calibrator::acceptCachedProfile()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  // 測定した時刻を表示用の文字列に変換する
+  char timeBuf[32] = "unknown";
+  time_t timestamp = static_cast<time_t>(profile.timestamp);
+  struct tm* localTime = localtime(&timestamp);
+  if(profile.timestamp > 0 && localTime != NULL) {
+    strftime(timeBuf, sizeof(timeBuf), "%Y-%m-%d %H:%M:%S", localTime);
+  }
+
+  snprintf(buf, BUF_SIZE,
+           "Cached calibration (course: %s, black: %d, white: %d, target: %d, measured at: %s)",
+           profile.isLeftCourse ? "Left" : "Right", profile.blackBrightness,
+           profile.whiteBrightness, profile.targetBrightness, timeBuf);
+  logger.log(buf);
+  logger.log("Press the Right Button to accept, or the Left Button to calibrate again");
+
+  // 右ボタンで再利用し、左ボタンで測定し直す
+  while(true) {
+    if(Measurer::getRightButton()) break;
+    if(Measurer::getLeftButton()) {
+      logger.log(">> Calibrate again");
+      timer.sleep(500);  // 500ミリ秒スリープ
+      return false;
+    }
+    timer.sleep();  // 10ミリ秒スリープ
+  }
+
+  isLeftCourse = profile.isLeftCourse;
+  targetBrightness = profile.targetBrightness;
+  snprintf(buf, BUF_SIZE, "\nWill Run on the %s Course\n", isLeftCourse ? "Left" : "Right");
+  logger.logHighlight(buf);
+  snprintf(buf, BUF_SIZE, ">> Target Brightness Value is %d", targetBrightness);
+  logger.log(buf);
+  return true;
 }
 
 void Calibrator::selectCourse()
@@ -49,6 +109,7 @@ void Calibrator::selectCourse()
   }
 
   isLeftCourse = _isLeftCourse;
+  profile.isLeftCourse = isLeftCourse;
   const char* course = isLeftCourse ? "Left" : "Right";
   snprintf(buf, BUF_SIZE, "\nWill Run on the %s Course\n", course);
   logger.logHighlight(buf);
@@ -67,16 +128,20 @@ void Calibrator::measureTargetBrightness()
 
   // 黒線上で左ボタンを押して黒の輝度を取得し、右ボタンで決定する
   logger.log("Press the Left Button on the Black");
+  logger.log("(or the Enter Button to sweep the sensor across the line)");
 
   // 黒
   // 左ボタンで輝度を取得し、右ボタンで黒の輝度を決定する
   while(blackBrightness < 0 || !Measurer::getRightButton()) {
     // 左ボタンが押されるまで待機
     while(blackBrightness < 0 && !Measurer::getLeftButton()) {
+      // 中央ボタンが押された場合は、ラインを横切る間の輝度の分布から求める
+      if(Measurer::getEnterButton() && sweepTargetBrightness()) return;
       timer.sleep();  // 10ミリ秒スリープ
     }
     // 輝度取得
     blackBrightness = Measurer::getBrightness();
+    profile.blackRgb = Measurer::getLastRawColor();
     snprintf(buf, BUF_SIZE, ">> Black Brightness Value is %d", blackBrightness);
     logger.log(buf);
     timer.sleep();  // 10ミリ秒スリープ
@@ -94,14 +159,90 @@ void Calibrator::measureTargetBrightness()
     }
     // 輝度取得
     whiteBrightness = Measurer::getBrightness();
+    profile.whiteRgb = Measurer::getLastRawColor();
     snprintf(buf, BUF_SIZE, ">> White Brightness Value is %d", whiteBrightness);
     logger.log(buf);
     timer.sleep();  // 10ミリ秒スリープ
   }
 
+  profile.blackBrightness = blackBrightness;
+  profile.whiteBrightness = whiteBrightness;
   targetBrightness = (whiteBrightness + blackBrightness) / 2;
+  profile.targetBrightness = targetBrightness;
+  snprintf(buf, BUF_SIZE, ">> Target Brightness Value is %d", targetBrightness);
+  logger.log(buf);
+
+  // 1点ずつの測定では変換表を求められないため、前回の変換表は使わない
+  if(transferPath != nullptr) {
+    BrightnessLinearizer::clear();
+    remove(transferPath);
+  }
+}
+
+bool Calibrator::sweepTargetBrightness()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+  BrightnessStatistics statistics;
+  rgb_raw_t darkestRgb = Measurer::getLastRawColor();
+  rgb_raw_t brightestRgb = darkestRgb;
+  int darkest = 101;
+  int brightest = -1;
+
+  snprintf(buf, BUF_SIZE, ">> Slide the sensor across the line (%d samples)", SWEEP_SAMPLE_COUNT);
+  logger.log(buf);
+
+  // 10ミリ秒ごとに輝度を集める
+  for(int i = 0; i < SWEEP_SAMPLE_COUNT; i++) {
+    int brightness = Measurer::getBrightness();
+    statistics.addSample(brightness);
+    // 最も暗いときと明るいときのRGB値を黒と白のRGB値とする
+    if(brightness < darkest) {
+      darkest = brightness;
+      darkestRgb = Measurer::getLastRawColor();
+    }
+    if(brightness > brightest) {
+      brightest = brightness;
+      brightestRgb = Measurer::getLastRawColor();
+    }
+    timer.sleep();  // 10ミリ秒スリープ
+  }
+
+  double blackLevel = statistics.calcBlackLevel();
+  double whiteLevel = statistics.calcWhiteLevel();
+  int threshold = statistics.calcThreshold();
+  snprintf(buf, BUF_SIZE,
+           ">> Sweep statistics (min: %d, max: %d, mean: %.1f, stddev: %.1f, threshold: %d, "
+           "black: %.1f, white: %.1f)",
+           statistics.getMin(), statistics.getMax(), statistics.getMean(),
+           statistics.getStandardDeviation(), threshold, blackLevel, whiteLevel);
+  logger.log(buf);
+
+  // 黒と白の輝度の差が小さい場合はラインを横切れていないため、ボタンでの測定に戻る
+  if(whiteLevel - blackLevel < MIN_SWEEP_CONTRAST) {
+    logger.logWarning("The sweep did not cross the line. Press the Left Button on the Black");
+    return false;
+  }
+
+  profile.blackBrightness = static_cast<int>(round(blackLevel));
+  profile.whiteBrightness = static_cast<int>(round(whiteLevel));
+  profile.blackRgb = darkestRgb;
+  profile.whiteRgb = brightestRgb;
+  // 大津の方法で求めた閾値を目標輝度とする
+  targetBrightness = threshold;
+  profile.targetBrightness = targetBrightness;
   snprintf(buf, BUF_SIZE, ">> Target Brightness Value is %d", targetBrightness);
   logger.log(buf);
+
+  // 変換表を求めて、ライントレースの輝度の線形化に使う
+  if(transferPath != nullptr) {
+    double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];
+    statistics.buildTransferFunction(table);
+    BrightnessLinearizer::setTable(table);
+    BrightnessLinearizer::save(transferPath);
+  }
+  return true;
 }
 
 void Calibrator::waitForStart()
@@ -115,8 +256,8 @@ void Calibrator::waitForStart()
   snprintf(buf, BUF_SIZE, "On standby.\n\nSignal within %dcm from Sonar Sensor.", startDistance);
   logger.log(buf);
 
-  // startDistance以内の距離に物体がない間待機する
-  while(Measurer::getForwardDistance() > startDistance) {
+  // startDistance以内の距離に物体がない間待機する(距離は計測タスクが保持している値を使う)
+  while(SonarSampler::getDistance() > startDistance * 10) {
     timer.sleep();  // 10ミリ秒スリープ
   }
 }
@@ -129,4 +270,88 @@ bool Calibrator::getIsLeftCourse()
 int Calibrator::getTargetBrightness()
 {
   return targetBrightness;
+}
+
+CalibrationProfile Calibrator::getProfile()
+{
+  return profile;
+}
+
+bool Calibrator::loadProfile(const char* filePath, CalibrationProfile& profile)
+{
+  const int BUF_SIZE = 128;
+  FILE* fp = fopen(filePath, "r");
+  // ファイルがない場合は保存された結果がないものとする
+  if(fp == NULL) return false;
+
+  CalibrationProfile loaded = profile;
+  int loadedItemCount = 0;      // 読み込めた項目の数
+  bool isTargetLoaded = false;  // true:目標輝度を読み込めた, false:読み込めていない
+  char row[BUF_SIZE];           // 各行の文字を一時的に保持する領域
+  char course[BUF_SIZE];
+  int r, g, b;
+  // 各行は「項目名,値」の形式とする
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    if(sscanf(row, "course,%127[A-Za-z]", course) == 1) {
+      loaded.isLeftCourse = strcmp(course, "Left") == 0;
+      loadedItemCount++;
+    } else if(sscanf(row, "blackBrightness,%d", &loaded.blackBrightness) == 1) {
+      loadedItemCount++;
+    } else if(sscanf(row, "whiteBrightness,%d", &loaded.whiteBrightness) == 1) {
+      loadedItemCount++;
+    } else if(sscanf(row, "targetBrightness,%d", &loaded.targetBrightness) == 1) {
+      isTargetLoaded = true;
+    } else if(sscanf(row, "blackRgb,%d,%d,%d", &r, &g, &b) == 3) {
+      loaded.blackRgb.r = r;
+      loaded.blackRgb.g = g;
+      loaded.blackRgb.b = b;
+      loadedItemCount++;
+    } else if(sscanf(row, "whiteRgb,%d,%d,%d", &r, &g, &b) == 3) {
+      loaded.whiteRgb.r = r;
+      loaded.whiteRgb.g = g;
+      loaded.whiteRgb.b = b;
+      loadedItemCount++;
+    } else if(sscanf(row, "timestamp,%ld", &loaded.timestamp) == 1) {
+      loadedItemCount++;
+    }
+  }
+  fclose(fp);
+
+  // 項目が欠けている場合は使わない
+  const int PROFILE_ITEM_COUNT = 6;
+  if(loadedItemCount < PROFILE_ITEM_COUNT) {
+    Logger logger;
+    char buf[BUF_SIZE];
+    snprintf(buf, BUF_SIZE, "Calibration profile '%s' is incomplete", filePath);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  // 目標輝度を保存していない以前の形式の場合は、黒と白の輝度の中間を目標輝度とする
+  if(!isTargetLoaded) {
+    loaded.targetBrightness = (loaded.whiteBrightness + loaded.blackBrightness) / 2;
+  }
+
+  profile = loaded;
+  return true;
+}
+
+bool Calibrator::saveProfile(const char* filePath, const CalibrationProfile& profile)
+{
+  FILE* fp = fopen(filePath, "w");
+  if(fp == NULL) {
+    Logger logger;
+    logger.logWarning("cannot open calibration profile file");
+    return false;
+  }
+
+  fprintf(fp, "course,%s\n", profile.isLeftCourse ? "Left" : "Right");
+  fprintf(fp, "blackBrightness,%d\n", profile.blackBrightness);
+  fprintf(fp, "whiteBrightness,%d\n", profile.whiteBrightness);
+  fprintf(fp, "targetBrightness,%d\n", profile.targetBrightness);
+  fprintf(fp, "blackRgb,%d,%d,%d\n", profile.blackRgb.r, profile.blackRgb.g, profile.blackRgb.b);
+  fprintf(fp, "whiteRgb,%d,%d,%d\n", profile.whiteRgb.r, profile.whiteRgb.g, profile.whiteRgb.b);
+  fprintf(fp, "timestamp,%ld\n", profile.timestamp);
+  fclose(fp);
+  return true;
 }
\ No newline at end of file
@@ -7,19 +7,40 @@
 #ifndef CALIBRATOR_H
 #define CALIBRATOR_H
 
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include "Measurer.h"
 #include "Timer.h"
 #include "Logger.h"
+#include "BrightnessStatistics.h"
+#include "BrightnessLinearizer.h"
+#include "SonarSampler.h"
+
+// キャリブレーションの結果(次回の起動時に再利用する)
+struct CalibrationProfile {
+  bool isLeftCourse;     // true:Lコース, false: Rコース
+  int blackBrightness;   // 黒の輝度
+  int whiteBrightness;   // 白の輝度
+  int targetBrightness;  // 目標輝度(ラインを横切って求めた場合は大津の方法の閾値)
+  rgb_raw_t blackRgb;    // 黒のRGB値
+  rgb_raw_t whiteRgb;    // 白のRGB値
+  long timestamp;        // 測定した時刻(UNIX時間[s])
+};
 
 class Calibrator {
  public:
   /**
    * コンストラクタ
+   * @param _profilePath キャリブレーション結果を保存するファイルのパス(nullptrの場合は保存しない)
+   * @param _transferPath 輝度の変換表を保存するファイルのパス(nullptrの場合は保存せず、
+   *                      BrightnessLinearizerにも設定しない)
    */
-  Calibrator();
+  Calibrator(const char* _profilePath = nullptr, const char* _transferPath = nullptr);
 
   /**
    * キャリブレーション処理（入力系）をまとめて実行する
+   * @note 前回の画像の削除などの準備はEtRobocon2023::startがバックグラウンドで行う
    */
   void run();
 
@@ -40,11 +61,47 @@ class Calibrator {
    */
   int getTargetBrightness();
 
+  /**
+   * 直近のキャリブレーション結果のゲッター
+   * @return キャリブレーション結果
+   */
+  CalibrationProfile getProfile();
+
+  /**
+   * キャリブレーション結果をファイルから読み込む
+   * @param filePath ファイルのパス
+   * @param profile 読み込んだ結果を格納する変数
+   * @return true:読み込めた, false:ファイルがないか、項目が欠けている
+   */
+  static bool loadProfile(const char* filePath, CalibrationProfile& profile);
+
+  /**
+   * キャリブレーション結果をファイルに書き出す
+   * @param filePath ファイルのパス
+   * @param profile キャリブレーション結果
+   * @return true:書き出せた, false:ファイルを開けない
+   */
+  static bool saveProfile(const char* filePath, const CalibrationProfile& profile);
+
+  static constexpr const char* DEFAULT_PROFILE_PATH = "calibration_profile.csv";
+  static constexpr int SWEEP_SAMPLE_COUNT = 300;  // ラインを横切る間に集める輝度のサンプル数
+  static constexpr int MIN_SWEEP_CONTRAST = 20;   // 黒と白を区別できる輝度の差の下限
+
  private:
-  bool isLeftCourse;     // true:Lコース, false: Rコース
-  int targetBrightness;  // 目標輝度
+  bool isLeftCourse;           // true:Lコース, false: Rコース
+  int targetBrightness;        // 目標輝度
+  CalibrationProfile profile;  // 直近のキャリブレーション結果
+  const char* profilePath;     // キャリブレーション結果を保存するファイルのパス
+  const char* transferPath;    // 輝度の変換表を保存するファイルのパス
   Timer timer;
 
+  /**
+   * 保存されたキャリブレーション結果を表示し、ボタンで再利用するかを選ぶ
+   * @return true:保存された結果を再利用する, false:測定し直す
+   * @note 右ボタンで再利用し、左ボタンで測定し直す
+   */
+  bool acceptCachedProfile();
+
   /**
    * 左右ボタンでLRコースを選択してisLeftCourseをセットする
    */
@@ -54,6 +111,12 @@ class Calibrator {
    * 黒と白の輝度を測定して目標輝度を求めtargetBrightnessをセットする
    */
   void measureTargetBrightness();
+
+  /**
+   * ラインを横切るように走行体を動かす間に輝度を集め、分布から目標輝度と変換表を求める
+   * @return true:黒と白を区別できた, false:輝度の差が小さく区別できない
+   */
+  bool sweepTargetBrightness();
 };
 
 #endif
\ No newline at end of file
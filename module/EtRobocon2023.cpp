@@ -17,6 +17,14 @@
 #include "Motor.h"
 #include "Clock.h"
 #include "Timer.h"
+#include "TelemetryRecorder.h"
+#include "Odometry.h"
+#include "PidGainStore.h"
+#include "LateralOffsetEstimator.h"
+#include "FeedforwardModel.h"
+#include "BackgroundJob.h"
+#include "StartupTimeline.h"
+#include "SonarSampler.h"
 
 void EtRobocon2023::start()
 {
@@ -42,6 +50,10 @@ void EtRobocon2023::start()
   Measurer::leftMotor = _leftMotorPtr;
   Measurer::armMotor = _armMotorPtr;
   Timer::clock = _clockPtr;
+  // 計測タスクが使うポインタを設定し終えてから、超音波センサの周期的な計測を始める
+  SonarSampler::start();
+  // 起動から開始合図を待つまでの所要時間の記録を始める
+  StartupTimeline::begin();
 
   const int BUF_SIZE = 128;
   char buf[BUF_SIZE];  // logやコマンド用にメッセージを一時保持する領域
@@ -50,26 +62,61 @@ void EtRobocon2023::start()
   bool isLeftCourse = false;
   bool isLeftEdge = false;
   int targetBrightness = (WHITE_BRIGHTNESS + BLACK_BRIGHTNESS) / 2;
-  Calibrator calibrator;
+  // キャリブレーション結果と輝度の変換表を保存し、次回の起動時にボタン1つで再利用できるようにする
+  Calibrator calibrator(Calibrator::DEFAULT_PROFILE_PATH,
+                        BrightnessLinearizer::DEFAULT_FILE_PATH);
 
   // 強制終了(CTRL+C)のシグナルを登録する
   signal(SIGINT, sigint);
 
-  // 走行情報を初期化
+  // 走行データ（センサ値と指令PWM値）の記録を有効にする
+  TelemetryRecorder::setEnabled(true);
+
+  // 以前の走行で自動調整したPIDゲインがあれば読み込む
+  PidGainStore::load();
+  // 以前の走行で作った輝度→横ずれの変換表があれば読み込む
+  LateralOffsetEstimator::load();
+  // 以前の走行で較正した速度→PWM値のフィードフォワードモデルがあれば読み込む
+  FeedforwardModel::load();
+
+  StartupTimeline::mark("initialize");
+
+  // 走行情報の初期化と前回の画像の削除は、キャリブレーションと並行してバックグラウンドで行う
   snprintf(buf, BUF_SIZE, "bash ./etrobocon2023/scripts/init_robot_info.sh %s", RAS_PI_IP);
-  system(buf);
+  BackgroundJob initRobotInfoJob("init_robot_info", buf);
+  BackgroundJob removeImageJob("rm-img", "cd etrobocon2023/rear_camera_py && make rm-img");
+  initRobotInfoJob.start();
+  removeImageJob.start();
+  StartupTimeline::mark("start background jobs");
 
   // キャリブレーションする
   calibrator.run();
   isLeftCourse = calibrator.getIsLeftCourse();
   isLeftEdge = isLeftCourse;
   targetBrightness = calibrator.getTargetBrightness();
+  StartupTimeline::mark("calibration");
+
+  // 開始合図を待つ前にバックグラウンドのジョブの完了を待つ
+  initRobotInfoJob.join();
+  removeImageJob.join();
+  StartupTimeline::mark("join background jobs");
 
   // 走行状態をwait(開始合図待ち)に変更
   setState("wait");
+  StartupTimeline::mark("set state");
+  // 起動から開始合図を待つまでの所要時間を出力する
+  StartupTimeline::logSummary();
+
   // 合図を送るまで待機する
   calibrator.waitForStart();
 
+  // バッテリー電圧によるPWM値の補正を有効にする
+  Controller::setVoltageCompensation(true);
+  Controller::updateVoltage();
+  snprintf(buf, BUF_SIZE, "Battery voltage: %.2fV (PWM compensation ratio: %.2f)",
+           Controller::getFilteredVoltage(), Controller::getVoltageCompensationRatio());
+  logger.log(buf);
+
   // 走行状態をstart(走行開始)に変更
   setState("start");
   // スタートのメッセージログを出す
@@ -83,6 +130,9 @@ void EtRobocon2023::start()
   AreaMaster blockDeTreasureAreaMaster(Area::BlockDeTreasure, isLeftCourse, isLeftEdge,
                                        targetBrightness);
 
+  // スタート地点を走行体の位置と向きの原点とする
+  Odometry::reset();
+
   // LAPゲートを通過する
   lineTraceAreaMaster.run();
   // 走行状態をlap(LAPゲート通過)に変更
@@ -102,6 +152,11 @@ void EtRobocon2023::start()
   // 走行終了のメッセージログを出す
   logger.logHighlight("The run has been completed\n");
 
+  // 超音波センサの周期的な計測を止める
+  SonarSampler::stop();
+
+  // 走行データファイルを生成する(ログファイルと一緒に退避される)
+  TelemetryRecorder::outputToFile();
   // ログファイルを生成する
   logger.outputToFile();
 }
@@ -110,6 +165,7 @@ void EtRobocon2023::sigint(int _)
 {
   Logger logger;
   logger.log("Forced termination.");  // 強制終了のログを出力
+  TelemetryRecorder::outputToFile();  // 走行データファイルを生成
   logger.outputToFile();              // ログファイルを生成
   _exit(0);                           // システムコールで強制終了
 }
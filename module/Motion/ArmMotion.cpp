@@ -8,11 +8,61 @@
 
 using namespace std;
 
-ArmMotion::ArmMotion(int _angle, int _pwm) : angle(_angle), pwm(_pwm) {}
+ArmMotion::ArmMotion(int _angle, int _pwm)
+  : angle(_angle),
+    pwm(_pwm),
+    isProfiled(false),
+    maxSpeed(ArmController::MAX_SPEED),
+    maxAcceleration(ArmController::MAX_ACCELERATION),
+    settled(false),
+    isRunning(false),
+    initCount(0),
+    cycleCount(0),
+    prevTime(0),
+    armController(_pwm)
+{
+}
+
+void ArmMotion::setProfile(double _maxSpeed, double _maxAcceleration)
+{
+  maxSpeed = _maxSpeed;
+  maxAcceleration = _maxAcceleration;
+  isProfiled = true;
+}
 
 void ArmMotion::run()
 {
-  int initCount = Measurer::getArmMotorCount();
+  if(!begin()) return;
+
+  // アームが目標角位置で静定するまでループ
+  while(true) {
+    // 制限時間・制限距離を超えたときはループから抜ける(アームモータは止められている)
+    if(MotionWatchdog::isExpired()) {
+      isRunning = false;
+      break;
+    }
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+
+    if(!resume()) break;
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 10ミリ秒待機
+    timer.sleep(10);
+  }
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+}
+
+bool ArmMotion::begin()
+{
+  initCount = Measurer::getArmMotorCount();
+  settled = false;
+  isRunning = false;
 
   const int BUF_SIZE = 128;
   char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
@@ -21,7 +71,7 @@ void ArmMotion::run()
   if(pwm <= 0) {
     snprintf(buf, BUF_SIZE, "The pwm value passed to ArmMotion is %d", pwm);
     logger.logWarning(buf);
-    return;
+    return false;
   }
 
   // pwmが40より大きい場合はwarningを出してpwmを40にする
@@ -35,7 +85,7 @@ void ArmMotion::run()
   if(angle == 0) {
     snprintf(buf, BUF_SIZE, "The angle value passed to ArmMotion is %d", angle);
     logger.logWarning(buf);
-    return;
+    return false;
   }
 
   // angleが60より大きい場合はwarningを出してangleを60にする
@@ -52,27 +102,80 @@ void ArmMotion::run()
     angle = -60;
   }
 
-  while(true) {
-    int currentCount = Measurer::getArmMotorCount();
-
-    if(angle > 0) {
-      if(currentCount < initCount - angle) {
-        break;
-      }
-      Controller::setArmMotorPwm(-pwm);
-    } else {
-      if(currentCount > initCount - angle) {
-        break;
-      }
-      Controller::setArmMotorPwm(pwm);
+  // 角位置が減る向きを正の角度とする
+  armController = ArmController(pwm, maxSpeed, maxAcceleration);
+  armController.start(initCount, initCount - angle);
+  cycleCount = 0;
+  isRunning = true;
+  return true;
+}
+
+bool ArmMotion::resume()
+{
+  if(!isRunning) return false;
+
+  // 目標角位置に達した(軌道に追従させる場合は静定した)ら終える
+  // 軌道に追従させる場合のみ、静定しないまま待ち続けないよう制御周期の上限でも終える
+  bool isContinued = isProfiled ? resumeOnProfile() : resumeAtConstantPwm();
+  if(!isContinued || (isProfiled && cycleCount >= MAX_CYCLE_COUNT)) {
+    finish();
+    return false;
+  }
+  cycleCount++;
+  return true;
+}
+
+bool ArmMotion::resumeAtConstantPwm()
+{
+  int currentCount = Measurer::getArmMotorCount();
+
+  // 目標角位置を越えるまで一定のPWM値で動かす(止めた後の惰性はそのままにする)
+  if(angle > 0) {
+    if(currentCount < initCount - angle) {
+      settled = true;
+      return false;
+    }
+    Controller::setArmMotorPwm(-pwm);
+  } else {
+    if(currentCount > initCount - angle) {
+      settled = true;
+      return false;
     }
+    Controller::setArmMotorPwm(pwm);
+  }
+  return true;
+}
 
-    // 10ミリ秒待機
-    timer.sleep(10);
+bool ArmMotion::resumeOnProfile()
+{
+  // 前回のPWM値の計算からの経過時間[s]を求める(初回は制御周期の10ms)
+  uint64_t currentTime = timer.nowMicro();
+  double delta = cycleCount == 0 ? 0.01 : static_cast<double>(currentTime - prevTime) / 1000000.0;
+  prevTime = currentTime;
+
+  double armPwm = armController.update(Measurer::getArmMotorCount(), delta);
+  if(armController.isSettled()) {
+    settled = true;
+    return false;
   }
+  Controller::setArmMotorPwm(armPwm);
+  return true;
+}
+
+void ArmMotion::finish()
+{
+  isRunning = false;
 
   //アームモータの停止
   Controller::stopArmMotor();
+
+  if(!settled) {
+    const int BUF_SIZE = 128;
+    char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+    snprintf(buf, BUF_SIZE, "ArmMotion did not settle (angle: %d, count: %d)", angle,
+             Measurer::getArmMotorCount() - initCount);
+    logger.logWarning(buf);
+  }
 }
 
 void ArmMotion::logRunning()
@@ -82,4 +185,16 @@ void ArmMotion::logRunning()
 
   snprintf(buf, BUF_SIZE, "Run ArmMotion (angle: %d, pwm: %d)", angle, pwm);
   logger.log(buf);
+
+  // 軌道に追従させる場合はその設定のログを取る
+  if(isProfiled) {
+    snprintf(buf, BUF_SIZE, "Arm profile (maxSpeed: %.2f, maxAcceleration: %.2f)", maxSpeed,
+             maxAcceleration);
+    logger.log(buf);
+  }
+}
+
+bool ArmMotion::isSettled()
+{
+  return settled;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Measurer.h"
 #include "Controller.h"
 #include "Timer.h"
+#include "ArmController.h"
 
 class ArmMotion : public Motion {
  public:
@@ -18,23 +19,81 @@ class ArmMotion : public Motion {
    * コンストラクタ
    * @param _angle アームを上下する角度 0~60
    * @param _pwm PWM値 0~40
+   * @note 既定では一定のPWM値で動かし、目標角位置を越えたらモータを止める(惰性で少し越える)
    */
   ArmMotion(int _angle, int _pwm);
 
   /**
-   * @brief アームを動かす
+   * @brief 加減速を制限した軌道にPIDで追従させ、目標角位置で静定するまで待つようにする
+   * @param _maxSpeed 軌道の角速度の上限[deg/s]
+   * @param _maxAcceleration 軌道の角加速度の上限[deg/s^2]
+   * @note 設定した場合、コンストラクタで渡したPWM値は上限として使う
+   */
+  void setProfile(double _maxSpeed, double _maxAcceleration);
+
+  /**
+   * @brief アームを動かし、目標角位置に達する(軌道に追従させる場合は静定する)まで待つ
    */
   void run() override;
 
+  /**
+   * @brief アーム動作を開始する(引数の確認と軌道の設定)
+   * @return true:開始した, false:引数が不正なため開始しなかった
+   * @note 走行と並行して動かすときは、この後にCooperativeSchedulerに登録する
+   */
+  bool begin();
+
+  /**
+   * @brief アーム動作を1制御周期分だけ進める
+   * @return true:動作を続ける, false:静定した、または打ち切った(開始していない場合を含む)
+   */
+  bool resume() override;
+
   /**
    * @brief 実行のログを取る
    */
   void logRunning() override;
 
+  /**
+   * @brief 直前の実行でアームが静定したかを取得する
+   * @return true:静定した(軌道に追従させない場合は目標角位置に達した),
+   *         false:静定しないまま打ち切った(実行していない場合を含む)
+   */
+  bool isSettled();
+
+  // 軌道に追従させる場合に静定を待つ制御周期の上限(3秒)。一定のPWM値で動かす場合は制限しない
+  static constexpr int MAX_CYCLE_COUNT = 300;
+
  private:
-  int angle;  // 回転角度(deg) -60~60
-  int pwm;    // PWM値 0~40
+  int angle;                    // 回転角度(deg) -60~60
+  int pwm;                      // PWM値 0~40(軌道に追従させる場合は上限)
+  bool isProfiled;              // true:軌道にPIDで追従させる, false:一定のPWM値で動かす
+  double maxSpeed;              // 軌道の角速度の上限[deg/s]
+  double maxAcceleration;       // 軌道の角加速度の上限[deg/s^2]
+  bool settled;                 // true:直前の実行で静定した, false:静定していない
+  bool isRunning;               // true:動作中, false:開始していない、または終わった
+  int initCount;                // 開始時のアームモータ角位置
+  int cycleCount;               // 開始してからの制御周期の数
+  uint64_t prevTime;            // 前回PWM値を計算した時刻[us]
+  ArmController armController;  // アームの位置制御
   Timer timer;
+
+  /**
+   * @brief 一定のPWM値で1制御周期分だけ動かす
+   * @return true:動作を続ける, false:目標角位置に達した
+   */
+  bool resumeAtConstantPwm();
+
+  /**
+   * @brief 軌道に追従させて1制御周期分だけ動かす
+   * @return true:動作を続ける, false:静定した
+   */
+  bool resumeOnProfile();
+
+  /**
+   * @brief アームモータを止めて動作を終える
+   */
+  void finish();
 };
 
 #endif
\ No newline at end of file
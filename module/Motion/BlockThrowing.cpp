@@ -18,24 +18,39 @@ void BlockThrowing::run()
   PwmRotation postPR(postTargetAngle, rotationPwm, !isClockwise);
   DistanceStraight preDS(targetDistance, targetSpeed);
   DistanceStraight postDS(targetDistance, -targetSpeed);
-  Sleeping sl(500);
 
-  // ブロック投げ入れのための回頭と前進をする
+  // ブロック投げ入れのための回頭と前進をする(回頭の惰性が収まってから前進する)
   prePR.run();
-  sl.run();
+  waitForStandstill();
   preDS.run();
 
-  // アームを上げてブロックを放す
+  // アームを一定のPWM値で上げ、振り上げの勢いでブロックを放す
+  // (モータを止めた後もアームは惰性で上がるため、アームが静止してから下げ始める)
   raiseAM.run();
+  waitForStandstill();
 
-  // 復帰のための後退と回頭をする
-  postDS.run();
-  sl.run();
+  // 復帰のための後退と並行してアームを下げ、回頭をする
+  ParallelMotion postPM(postDS, lowerAM);
+  postPM.run();
+  waitForStandstill();
   postPR.run();
+}
 
-  // アームを下げる
-  sl.run();
-  lowerAM.run();
+void BlockThrowing::waitForStandstill()
+{
+  int standstillCount = 0;
+  int prevArmCount = Measurer::getArmMotorCount();
+  for(int i = 0; i < MAX_WAIT_CYCLE_COUNT && standstillCount < STANDSTILL_CYCLE_COUNT; i++) {
+    SpeedEstimator::update();
+    int armCount = Measurer::getArmMotorCount();
+    bool isStandstill = fabs(SpeedEstimator::getRightSpeed()) < STANDSTILL_SPEED
+                        && fabs(SpeedEstimator::getLeftSpeed()) < STANDSTILL_SPEED
+                        && armCount == prevArmCount;
+    prevArmCount = armCount;
+    standstillCount = isStandstill ? standstillCount + 1 : 0;
+    CooperativeScheduler::tick();
+    timer.sleep(10);
+  }
 }
 
 void BlockThrowing::logRunning()
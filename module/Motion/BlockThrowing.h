@@ -11,8 +11,9 @@
 #include "CompositeMotion.h"
 #include "PwmRotation.h"
 #include "ArmMotion.h"
+#include "ParallelMotion.h"
 #include "DistanceStraight.h"
-#include "Sleeping.h"
+#include "SpeedEstimator.h"
 
 class BlockThrowing : public CompositeMotion {
  public:
@@ -29,6 +30,10 @@ class BlockThrowing : public CompositeMotion {
    */
   void logRunning() override;
 
+  static constexpr double STANDSTILL_SPEED = 5.0;  // 止まったとみなす車輪の走行速度[mm/s]
+  static constexpr int STANDSTILL_CYCLE_COUNT = 3;  // 止まったとみなす連続した制御周期の数
+  static constexpr int MAX_WAIT_CYCLE_COUNT = 50;   // 止まるのを待つ制御周期の上限(0.5秒)
+
  private:
   const bool isClockwise = true;      // ブロック投げ入れの回頭方向
   const int armTargetAngle = 60;      // アームの目標回転角度
@@ -38,5 +43,13 @@ class BlockThrowing : public CompositeMotion {
   const int rotationPwm = 80;         // 回頭PWM
   const double targetDistance = 150;  // ブロック投げ入れのための目標距離
   const double targetSpeed = 150;     // ブロック投げ入れのための目標速度
+  Timer timer;
+
+  /**
+   * @brief 走行体とアームが実際に止まるまで待つ
+   * @note 左右の車輪の推定走行速度がSTANDSTILL_SPEED未満で、アームモータの角位置が変わらない
+   *       状態が続いたら止まったとみなす。MAX_WAIT_CYCLE_COUNTを超えたら待つのをやめる
+   */
+  void waitForStandstill();
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+/**
+ * @file   BrightnessSweep.cpp
+ * @brief  その場で左右に回頭してラインの縁を横切り、輝度→横ずれの変換表を作る動作
+ * @author KatLab
+ */
+
+#include "BrightnessSweep.h"
+using namespace std;
+
+BrightnessSweep::BrightnessSweep(double _sweepAngle, int _pwm)
+  : SweepRotation(_pwm), sweepAngle(_sweepAngle)
+{
+}
+
+void BrightnessSweep::run()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  // pwm値が0以下の場合はwarningを出して終了する
+  if(pwm <= 0) {
+    snprintf(buf, BUF_SIZE, "The pwm value passed to BrightnessSweep is %d", pwm);
+    logger.logWarning(buf);
+    return;
+  }
+  // sweepAngleが範囲外の場合はwarningを出して終了する
+  if(sweepAngle <= 0.0 || sweepAngle > 90.0) {
+    snprintf(buf, BUF_SIZE, "The sweepAngle value passed to BrightnessSweep is %.2f", sweepAngle);
+    logger.logWarning(buf);
+    return;
+  }
+
+  Odometry::update();
+  double initialTheta = Odometry::getPose().theta;
+  double sweepRadian = sweepAngle * M_PI / 180.0;
+  LateralOffsetEstimator::clearSamples();
+
+  // 左、右、正面の順に回頭してラインの縁を2回横切る
+  int sampleCount = 0;
+  sampleCount += rotateToAngle(initialTheta, sweepRadian, MAX_PHASE_CYCLE_COUNT);
+  sampleCount += rotateToAngle(initialTheta, -sweepRadian, MAX_PHASE_CYCLE_COUNT);
+  sampleCount += rotateToAngle(initialTheta, 0.0, MAX_PHASE_CYCLE_COUNT);
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
+  // モータの停止
+  Controller::stopMotor();
+
+  // 集めたサンプルから変換表を作り、以降のライントレースで使えるよう保存する
+  if(!LateralOffsetEstimator::build()) {
+    logger.logWarning("BrightnessSweep could not build the lateral offset table");
+    return;
+  }
+  LateralOffsetEstimator::save();
+  snprintf(buf, BUF_SIZE,
+           "Lateral offset table (samples: %d, offset: %.1fmm at brightness 0 to %.1fmm at 100)",
+           sampleCount, LateralOffsetEstimator::estimate(0), LateralOffsetEstimator::estimate(100));
+  logger.log(buf);
+}
+
+bool BrightnessSweep::sampleBrightness(double angle)
+{
+  // 回頭角からカラーセンサの横ずれを求め、輝度と組にして集める
+  LateralOffsetEstimator::addSample(Measurer::getBrightness(), COLOR_SENSOR_DISTANCE * sin(angle));
+  return true;
+}
+
+void BrightnessSweep::logRunning()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Run BrightnessSweep (sweepAngle: %.2f, pwm: %d)", sweepAngle, pwm);
+  logger.log(buf);
+}
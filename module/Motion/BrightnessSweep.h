@@ -0,0 +1,48 @@
+/**
+ * @file   BrightnessSweep.h
+ * @brief  その場で左右に回頭してラインの縁を横切り、輝度→横ずれの変換表を作る動作
+ * @author KatLab
+ */
+
+#ifndef BRIGHTNESS_SWEEP_H
+#define BRIGHTNESS_SWEEP_H
+
+#include "SweepRotation.h"
+#include "SystemInfo.h"
+#include "LateralOffsetEstimator.h"
+
+class BrightnessSweep : public SweepRotation {
+ public:
+  /**
+   * コンストラクタ
+   * @param _sweepAngle 左右に回頭する角度[deg](0より大きく90以下)
+   * @param _pwm 回頭のPWM値(0より大きい)
+   * @note ラインの縁の上にカラーセンサを置いた状態で実行する
+   */
+  BrightnessSweep(double _sweepAngle, int _pwm);
+
+  /**
+   * @brief 左、右、正面の順に回頭しながら輝度と横ずれを集め、変換表を作って保存する
+   * @note 横ずれはカラーセンサの回頭による横方向の移動量(COLOR_SENSOR_DISTANCE*sin(回頭角))とする
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+  static constexpr int MAX_PHASE_CYCLE_COUNT = 500;  // 1回の回頭の制御周期の上限(5秒)
+
+ private:
+  double sweepAngle;  // 左右に回頭する角度[deg]
+
+  /**
+   * @brief 回頭角からカラーセンサの横ずれを求め、輝度と組にしてサンプルを集める
+   * @param angle 初期の向きからの回頭角[rad](反時計回りが正)
+   * @return 常にtrue(目標の回頭角まで集め続ける)
+   */
+  bool sampleBrightness(double angle) override;
+};
+
+#endif
@@ -10,7 +10,13 @@ using namespace std;
 
 ColorLineTracing::ColorLineTracing(COLOR _targetColor, double _targetSpeed, int _targetBrightness,
                                    const PidGain& _gain, bool& _isLeftEdge)
-  : LineTracing(_targetSpeed, _targetBrightness, _gain, _isLeftEdge), targetColor(_targetColor){};
+  : LineTracing(_targetSpeed, _targetBrightness, _gain, _isLeftEdge),
+    targetColor(_targetColor),
+    // 停止が従来の連続判定より遅れないよう、連続してJUDGE_COUNT回指定色を取得した時点で確定する
+    colorEventDetector(_targetColor, JUDGE_COUNT, JUDGE_COUNT, 0, 0.0)
+{
+  setWatchdogLimit(DEFAULT_TIME_LIMIT, DEFAULT_DISTANCE_LIMIT);
+}
 
 bool ColorLineTracing::isMetPrecondition(double targetSpeed)
 {
@@ -30,25 +36,32 @@ bool ColorLineTracing::isMetPrecondition(double targetSpeed)
     return false;
   }
 
+  // 前回の実行の判定の途中経過を破棄する
+  colorEventDetector.reset();
+
   return true;
 }
 
 bool ColorLineTracing::isMetPostcondition()
 {
-  COLOR currentColor = COLOR::NONE;
+  // 色を判定した位置を記録するため、走行体の位置を更新してから判定する
+  Odometry::update();
+  COLOR currentColor = ColorJudge::getColor(Measurer::getRawColor());
 
-  currentColor = ColorJudge::getColor(Measurer::getRawColor());
-  if(currentColor == targetColor) {
-    colorCount++;
-  } else {
-    colorCount = 0;
+  // 指定色の区間に入ったことを確定したら終了する
+  if(colorEventDetector.update(currentColor, Odometry::getPose())) {
+    colorEventDetector.logDetection();
+    return false;
   }
-  // 指定された色をJUDGE_COUNT回連続で取得
-  if(colorCount >= JUDGE_COUNT) return false;
 
   return true;
 }
 
+Pose ColorLineTracing::getColorStartPose()
+{
+  return colorEventDetector.getStartPose();
+}
+
 void ColorLineTracing::logRunning()
 {
   const int BUF_SIZE = 256;
@@ -61,4 +74,9 @@ void ColorLineTracing::logRunning()
            ColorJudge::colorToString(targetColor), targetSpeed, targetBrightness, gain.kp, gain.ki,
            gain.kd, str);
   logger.log(buf);
+  logGainSchedule();
+  logSpeedRange();
+  logOffsetInput();
+  logLinearizedInput();
+  logLineRecovery();
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "LineTracing.h"
 #include "ColorJudge.h"
+#include "ColorEventDetector.h"
 
 class ColorLineTracing : public LineTracing {
  public:
@@ -41,16 +42,28 @@ class ColorLineTracing : public LineTracing {
    */
   bool isMetPostcondition() override;
 
+  /**
+   * @brief 指定色の区間が始まった位置を取得する
+   * @return 指定色の区間が始まった走行体の位置と向き(行き過ぎの補正に使う)
+   */
+  Pose getColorStartPose();
+
   /**
    * @brief 実行のログを取る
    * @note オーバーライド必須
    */
   void logRunning() override;
 
- private:
+  // 指定色を見つけられないまま走り続けないための既定の制限
+  static constexpr int DEFAULT_TIME_LIMIT = 30000;          // 既定の制限時間[ms]
+  static constexpr double DEFAULT_DISTANCE_LIMIT = 5000.0;  // 既定の制限距離[mm]
+
+  // 指定色の区間に入ったと確定する連続取得回数(従来の停止タイミングに合わせる)
   static constexpr int JUDGE_COUNT = 3;
-  int colorCount = 0;
-  COLOR targetColor;  // 指定色
+
+ private:
+  COLOR targetColor;                      // 指定色
+  ColorEventDetector colorEventDetector;  // 指定色の区間の検知
 };
 
 #endif
\ No newline at end of file
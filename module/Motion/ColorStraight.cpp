@@ -8,14 +8,23 @@
 using namespace std;
 
 ColorStraight::ColorStraight(COLOR _targetColor, double _targetSpeed)
-  : Straight(_targetSpeed), targetColor(_targetColor)
+  : Straight(_targetSpeed),
+    targetColor(_targetColor),
+    // 停止位置が目標色の手前側の縁からずれないよう、1回の判定で確定する
+    colorEventDetector(_targetColor, 1, 1, 0, 0.0)
 {
+  setWatchdogLimit(DEFAULT_TIME_LIMIT, DEFAULT_DISTANCE_LIMIT);
 }
 
 bool ColorStraight::isRunPostconditionJudgement()
 {
+  // 色を判定した位置を記録するため、走行体の位置を更新してから判定する
+  Odometry::update();
   COLOR color = ColorJudge::getColor(Measurer::getRawColor());
-  if(color == targetColor) {
+
+  // 目標色の区間に入ったことを確定したら終了する
+  if(colorEventDetector.update(color, Odometry::getPose())) {
+    colorEventDetector.logDetection();
     return true;
   }
 
@@ -35,9 +44,17 @@ bool ColorStraight::isRunPreconditionJudgement()
     return false;
   }
 
+  // 前回の実行の判定の途中経過を破棄する
+  colorEventDetector.reset();
+
   return true;
 }
 
+Pose ColorStraight::getColorStartPose()
+{
+  return colorEventDetector.getStartPose();
+}
+
 void ColorStraight::logRunning()
 {
   const int BUF_SIZE = 128;
@@ -9,6 +9,7 @@
 
 #include "Straight.h"
 #include "ColorJudge.h"
+#include "ColorEventDetector.h"
 
 class ColorStraight : public Straight {
  public:
@@ -29,13 +30,24 @@ class ColorStraight : public Straight {
    */
   virtual bool isRunPostconditionJudgement() override;
 
+  /**
+   * @brief 目標色の区間が始まった位置を取得する
+   * @return 目標色の区間が始まった走行体の位置と向き(行き過ぎの補正に使う)
+   */
+  Pose getColorStartPose();
+
   /**
    * @brief 実行のログを取る
    */
   virtual void logRunning() override;
 
+  // 目標色を見つけられないまま走り続けないための既定の制限
+  static constexpr int DEFAULT_TIME_LIMIT = 10000;          // 既定の制限時間[ms]
+  static constexpr double DEFAULT_DISTANCE_LIMIT = 1500.0;  // 既定の制限距離[mm]
+
  private:
-  COLOR targetColor;  // 目標色
+  COLOR targetColor;                      // 目標色
+  ColorEventDetector colorEventDetector;  // 目標色の区間の検知
 };
 
 #endif
\ No newline at end of file
@@ -58,4 +58,9 @@ void DistanceLineTracing::logRunning()
            "%d, gain: (%.2f,%.2f,%.2f), isLeftEdge: %s)",
            targetDistance, targetSpeed, targetBrightness, gain.kp, gain.ki, gain.kd, str);
   logger.log(buf);
+  logGainSchedule();
+  logSpeedRange();
+  logOffsetInput();
+  logLinearizedInput();
+  logLineRecovery();
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+/**
+ * @file   FeedforwardCalibration.cpp
+ * @brief  PWM値を段階的に上げながら直進し、車輪ごとのフィードフォワードモデルを較正する動作
+ * @author KatLab
+ */
+
+#include "FeedforwardCalibration.h"
+using namespace std;
+
+FeedforwardCalibration::FeedforwardCalibration(int _minPwm, int _maxPwm, int _stepPwm,
+                                               int _stepTime)
+  : minPwm(_minPwm), maxPwm(_maxPwm), stepPwm(_stepPwm), stepTime(_stepTime)
+{
+}
+
+void FeedforwardCalibration::run()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  // PWM値の範囲が不正な場合はwarningを出して終了する
+  if(minPwm <= 0 || maxPwm <= minPwm || maxPwm > 100 || stepPwm <= 0) {
+    snprintf(buf, BUF_SIZE,
+             "The pwm range passed to FeedforwardCalibration is %d to %d (step: %d)", minPwm,
+             maxPwm, stepPwm);
+    logger.logWarning(buf);
+    return;
+  }
+  // 段階の時間が短すぎて定常速度を計測できない場合はwarningを出して終了する
+  if(stepTime < MIN_STEP_TIME) {
+    snprintf(buf, BUF_SIZE, "The stepTime value passed to FeedforwardCalibration is %d",
+             stepTime);
+    logger.logWarning(buf);
+    return;
+  }
+
+  // 前の動作の走行速度を引き継がないよう、止まった状態から計測を始める
+  // 左右の角位置もそろえ、前の動作の端数で左右の計測値に差が出ないようにする
+  Measurer::resetCount();
+  SpeedEstimator::reset();
+  FeedforwardModel::clearSamples();
+  int stepCount = 0;
+  for(int pwm = minPwm; pwm <= maxPwm; pwm += stepPwm) {
+    double rightSpeed = 0.0;
+    double leftSpeed = 0.0;
+    if(!runStep(pwm, rightSpeed, leftSpeed)) break;
+    FeedforwardModel::addSample(pwm, rightSpeed, leftSpeed);
+    stepCount++;
+  }
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
+  // モータの停止
+  Controller::stopMotor();
+
+  // 計測した定常速度にモデルを当てはめ、以降の走行で使えるよう保存する
+  if(!FeedforwardModel::fit()) {
+    snprintf(buf, BUF_SIZE, "FeedforwardCalibration could not fit the model (steps: %d)",
+             stepCount);
+    logger.logWarning(buf);
+    return;
+  }
+  FeedforwardModel::save();
+  FeedforwardParam right = FeedforwardModel::getRight();
+  FeedforwardParam left = FeedforwardModel::getLeft();
+  snprintf(buf, BUF_SIZE,
+           "Feedforward model (steps: %d, right: %.2f + %.4f * speed, left: %.2f + %.4f * speed)",
+           stepCount, right.deadbandPwm, right.slope, left.deadbandPwm, left.slope);
+  logger.log(buf);
+}
+
+bool FeedforwardCalibration::runStep(int pwm, double& rightSpeed, double& leftSpeed)
+{
+  int cycleCount = stepTime / 10;
+  int sampleCount = 0;
+  double rightSpeedSum = 0.0;
+  double leftSpeedSum = 0.0;
+
+  for(int i = 0; i < cycleCount; i++) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) return false;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
+    // 加速が落ち着いた後半の速度を集める
+    SpeedEstimator::update();
+    if(i >= cycleCount / 2) {
+      rightSpeedSum += SpeedEstimator::getRightSpeed();
+      leftSpeedSum += SpeedEstimator::getLeftSpeed();
+      sampleCount++;
+    }
+
+    // モータにPWM値をセット
+    Controller::setRightMotorPwm(pwm);
+    Controller::setLeftMotorPwm(pwm);
+
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 10ミリ秒待機
+    timer.sleep(10);
+  }
+
+  rightSpeed = rightSpeedSum / sampleCount;
+  leftSpeed = leftSpeedSum / sampleCount;
+  return true;
+}
+
+void FeedforwardCalibration::logRunning()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE,
+           "Run FeedforwardCalibration (minPwm: %d, maxPwm: %d, stepPwm: %d, stepTime: %d)",
+           minPwm, maxPwm, stepPwm, stepTime);
+  logger.log(buf);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file   FeedforwardCalibration.h
+ * @brief  PWM値を段階的に上げながら直進し、車輪ごとのフィードフォワードモデルを較正する動作
+ * @author KatLab
+ */
+
+#ifndef FEEDFORWARD_CALIBRATION_H
+#define FEEDFORWARD_CALIBRATION_H
+
+#include "Motion.h"
+#include "SpeedEstimator.h"
+#include "FeedforwardModel.h"
+
+class FeedforwardCalibration : public Motion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _minPwm 最初の段階のPWM値(0より大きい)
+   * @param _maxPwm 最後の段階のPWM値(_minPwmより大きく100以下)
+   * @param _stepPwm 段階ごとに上げるPWM値(0より大きい)
+   * @param _stepTime 1段階の時間[ms](後半の平均速度をその段階の速度とする)
+   * @note 直線上で実行する。走行距離はPWM値と段階の時間に応じて長くなる
+   */
+  FeedforwardCalibration(int _minPwm, int _maxPwm, int _stepPwm, int _stepTime);
+
+  /**
+   * @brief 段階ごとに左右の車輪の定常速度を計測し、モデルを当てはめて保存する
+   * @note 当てはめられなかった場合はwarningを出し、モデルを変えない
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+  static constexpr int MIN_STEP_TIME = 200;  // 定常速度を計測できる1段階の時間の下限[ms]
+
+ private:
+  int minPwm;    // 最初の段階のPWM値
+  int maxPwm;    // 最後の段階のPWM値
+  int stepPwm;   // 段階ごとに上げるPWM値
+  int stepTime;  // 1段階の時間[ms]
+  Timer timer;
+
+  /**
+   * @brief 1段階分のPWM値で直進し、後半の平均速度を計測する
+   * @param pwm 左右の車輪に指令するPWM値
+   * @param rightSpeed 計測した右車輪の平均速度[mm/s]を格納する変数
+   * @param leftSpeed 計測した左車輪の平均速度[mm/s]を格納する変数
+   * @return true:計測した, false:制限を超えて打ち切った
+   */
+  bool runStep(int pwm, double& rightSpeed, double& leftSpeed);
+};
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file   HeadingRotation.cpp
+ * @brief  走行体の向きを指定する回頭動作
+ * @author KatLab
+ */
+
+#include "HeadingRotation.h"
+
+using namespace std;
+
+HeadingRotation::HeadingRotation(double _targetHeading, double _targetSpeed)
+  : Rotation(_targetSpeed, true), targetHeading(_targetHeading){};
+
+bool HeadingRotation::isMetPrecondition()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];
+
+  // targetSpeed値が0以下の場合はwarningを出して終了する
+  if(targetSpeed <= 0) {
+    snprintf(buf, BUF_SIZE, "The targetSpeed value passed to HeadingRotation is %lf",
+             targetSpeed);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  // 回転角が小さくなる方向に回頭する(反時計回りが正)
+  Odometry::update();
+  double angle = Odometry::calcAngleTo(targetHeading * M_PI / 180.0);
+  isClockwise = angle < 0.0;
+
+  // すでに目標の向きを向いている場合は回頭しない
+  if(fabs(angle) * 180.0 / M_PI < NO_ROTATION_ANGLE) {
+    return false;
+  }
+
+  return true;
+}
+
+bool HeadingRotation::isMetPostcondition(double /*initLeftMileage*/, double /*initRightMileage*/,
+                                         int /*leftSign*/, int /*rightSign*/)
+{
+  // 目標の向きに到達した場合
+  if(calcRemainingAngle() <= 0.0) {
+    return false;
+  }
+  return true;
+}
+
+double HeadingRotation::calcRemainingAngle()
+{
+  Odometry::update();
+  double angle = Odometry::calcAngleTo(targetHeading * M_PI / 180.0);
+  // 時計回りの場合は符号を反転し、回頭方向に測った角度にする
+  return isClockwise ? -angle : angle;
+}
+
+void HeadingRotation::logRunning()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Run HeadingRotation (targetHeading: %.2f, targetSpeed: %.2f)",
+           targetHeading, targetSpeed);
+  logger.log(buf);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file   HeadingRotation.h
+ * @brief  走行体の向きを指定する回頭動作
+ * @author KatLab
+ */
+
+#ifndef HEADING_ROTATION_H
+#define HEADING_ROTATION_H
+
+#include "Rotation.h"
+#include "Odometry.h"
+
+class HeadingRotation : public Rotation {
+ public:
+  /**
+   * コンストラクタ
+   * @param _targetHeading 目標の向き[deg](スタート時の正面が0、反時計回りが正)
+   * @param _targetSpeed 目標速度[mm/s]
+   * @note 回頭方向は実行時の向きから回転角が小さくなる方向に決める
+   */
+  HeadingRotation(double _targetHeading, double _targetSpeed);
+
+  /**
+   * @brief 回頭する
+   */
+  using Rotation::run;
+
+  /**
+   * @brief 回頭する際の事前条件判定をする
+   * @note 実行時の向きから回頭方向を決める
+   */
+  bool isMetPrecondition() override;
+
+  /**
+   * @brief 回頭する際の継続条件判定をする　返り値がfalseでモーターが止まる
+   * @param leftSign 左車輪の回転方向
+   * @param rightSign 右車輪の回転方向
+   * @note 引数は使わず、走行体の向きだけで判定する
+   */
+  bool isMetPostcondition(double initLeftMileage, double initRightMileage, int leftSign,
+                          int rightSign) override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+ private:
+  static constexpr double NO_ROTATION_ANGLE = 1.0;  // 回頭を免除する角度[deg]
+  double targetHeading;                             // 目標の向き[deg]
+
+  /**
+   * @brief 目標の向きまでの残りの回転角を求める
+   * @return 回頭方向に測った残りの回転角[rad]
+   */
+  double calcRemainingAngle();
+};
+
+#endif
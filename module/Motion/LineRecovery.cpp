@@ -0,0 +1,101 @@
+/**
+ * @file   LineRecovery.cpp
+ * @brief  見失ったラインをその場での回頭で探し直す動作
+ * @author KatLab
+ */
+
+#include "LineRecovery.h"
+using namespace std;
+
+LineRecovery::LineRecovery(bool _isClockwise, double _sweepAngle, int _pwm, int _targetBrightness)
+  : SweepRotation(_pwm),
+    isClockwise(_isClockwise),
+    sweepAngle(_sweepAngle),
+    targetBrightness(_targetBrightness),
+    initialSide(0),
+    found(false),
+    foundAngle(0.0)
+{
+}
+
+void LineRecovery::run()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  found = false;
+  foundAngle = 0.0;
+
+  // pwm値が0以下の場合はwarningを出して終了する
+  if(pwm <= 0) {
+    snprintf(buf, BUF_SIZE, "The pwm value passed to LineRecovery is %d", pwm);
+    logger.logWarning(buf);
+    return;
+  }
+  // sweepAngleが0以下の場合はwarningを出して終了する
+  if(sweepAngle <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The sweepAngle value passed to LineRecovery is %.2f", sweepAngle);
+    logger.logWarning(buf);
+    return;
+  }
+
+  // 既に目標輝度をまたいでいる場合は回頭しない
+  int brightness = Measurer::getBrightness();
+  if(brightness == targetBrightness) {
+    found = true;
+    Controller::stopMotor();
+    return;
+  }
+  initialSide = brightness > targetBrightness ? 1 : -1;
+
+  Odometry::update();
+  double initialTheta = Odometry::getPose().theta;
+  double sweepRadian = sweepAngle * M_PI / 180.0;
+  int direction = isClockwise ? -1 : 1;  // 1:反時計回り, -1:時計回り
+
+  // 最初の向きに探し、見つからなければ反対の向きへ振り戻して探す
+  rotateToAngle(initialTheta, sweepRadian * direction, MAX_PHASE_CYCLE_COUNT);
+  if(!found) {
+    rotateToAngle(initialTheta, -sweepRadian * direction, MAX_PHASE_CYCLE_COUNT);
+  }
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
+  // モータの停止
+  Controller::stopMotor();
+}
+
+bool LineRecovery::sampleBrightness(double angle)
+{
+  // 輝度が目標輝度をまたいだらラインの縁を見つけたとみなす
+  if((Measurer::getBrightness() - targetBrightness) * initialSide <= 0) {
+    found = true;
+    foundAngle = angle;
+    return false;
+  }
+  return true;
+}
+
+void LineRecovery::logRunning()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  const char* str = isClockwise ? "true" : "false";
+
+  snprintf(buf, BUF_SIZE, "Run LineRecovery (isClockwise: %s, sweepAngle: %.2f, pwm: %d)", str,
+           sweepAngle, pwm);
+  logger.log(buf);
+}
+
+bool LineRecovery::isFound()
+{
+  return found;
+}
+
+double LineRecovery::getFoundAngle()
+{
+  return foundAngle * 180.0 / M_PI;
+}
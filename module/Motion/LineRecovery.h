@@ -0,0 +1,63 @@
+/**
+ * @file   LineRecovery.h
+ * @brief  見失ったラインをその場での回頭で探し直す動作
+ * @author KatLab
+ */
+
+#ifndef LINE_RECOVERY_H
+#define LINE_RECOVERY_H
+
+#include "SweepRotation.h"
+
+class LineRecovery : public SweepRotation {
+ public:
+  /**
+   * コンストラクタ
+   * @param _isClockwise 最初に探す向き(true:時計回り, false:反時計回り)
+   * @param _sweepAngle 左右それぞれに探す角度[deg](0より大きい)
+   * @param _pwm 回頭のPWM値(0より大きい)
+   * @param _targetBrightness 目標輝度(輝度がこの値をまたいだらラインの縁を見つけたとみなす)
+   */
+  LineRecovery(bool _isClockwise, double _sweepAngle, int _pwm, int _targetBrightness);
+
+  /**
+   * @brief 最初の向きに回頭してラインの縁を探し、見つからなければ反対の向きに振り戻して探す
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+  /**
+   * @brief ラインの縁を見つけたかを取得する
+   * @return true:見つけた, false:見つけていない
+   */
+  bool isFound();
+
+  /**
+   * @brief ラインの縁を見つけるまでに回頭した角度を取得する
+   * @return 実行開始時の向きからの回頭角[deg](反時計回りが正)
+   */
+  double getFoundAngle();
+
+  static constexpr int MAX_PHASE_CYCLE_COUNT = 300;  // 1回の回頭の制御周期の上限(3秒)
+
+ private:
+  bool isClockwise;      // 最初に探す向き(true:時計回り, false:反時計回り)
+  double sweepAngle;     // 左右それぞれに探す角度[deg]
+  int targetBrightness;  // 目標輝度
+  int initialSide;       // 開始時に外れていた側(1:白側, -1:黒側)
+  bool found;            // true:ラインの縁を見つけた, false:見つけていない
+  double foundAngle;     // ラインの縁を見つけた回頭角[rad]
+
+  /**
+   * @brief 輝度が目標輝度をまたいだらラインの縁を見つけたとみなす
+   * @param angle 初期の向きからの回頭角[rad](反時計回りが正)
+   * @return true:回頭を続ける, false:ラインの縁を見つけた
+   */
+  bool sampleBrightness(double angle) override;
+};
+
+#endif
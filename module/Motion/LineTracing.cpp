@@ -12,19 +12,48 @@ LineTracing::LineTracing(double _targetSpeed, int _targetBrightness, const PidGa
   : targetSpeed(_targetSpeed),
     targetBrightness(_targetBrightness),
     gain(_gain),
+    minSpeed(_targetSpeed),
+    maxSpeed(_targetSpeed),
+    isSpeedAdaptive(false),
+    isOffsetInput(false),
+    isLinearizedInput(false),
+    maxRecoveryCount(0),
+    recoverySweepAngle(0.0),
+    recoveryCount(0),
     isLeftEdge(_isLeftEdge)
 {
 }
 
+void LineTracing::addGainScheduleLevel(double speed, const PidGain& straightGain,
+                                       const PidGain& curveGain)
+{
+  gainScheduleLevels.push_back(GainScheduleLevel(speed, straightGain, curveGain));
+}
+
 void LineTracing::run()
 {
   double turnPwm = 0.0;   // 旋回値を計算
   initialDistance = 0.0;  // 実行前の走行距離
   currentDistance = 0.0;  // 現在の走行距離
+  failed = false;
   int edgeSign = 0;
   double timeConstant = 0.001;  // 旋回値用PIDに渡す時定数
-  double initDeviation = double(targetBrightness) - double(Measurer::getBrightness());
-  Pid pid(gain.kp, gain.ki, gain.kd, targetBrightness, initDeviation, timeConstant);
+  // 横ずれを入力にする場合は変換表があれば横ずれで、なければ輝度のまま偏差を求める
+  bool isOffsetUsed = isOffsetInput && LateralOffsetEstimator::isEnabled();
+  if(isOffsetInput && !isOffsetUsed) {
+    logger.logWarning("The lateral offset table is not loaded, so brightness is used instead");
+  }
+  // 線形化した輝度を入力にする場合も、変換表がなければ輝度のまま偏差を求める
+  bool isLinearized = isLinearizedInput && BrightnessLinearizer::isEnabled();
+  if(isLinearizedInput && !isLinearized) {
+    logger.logWarning("The brightness transfer table is not loaded, so raw brightness is used");
+  }
+  double pidTarget = convertToPidInput(targetBrightness, isOffsetUsed, isLinearized);
+  double initDeviation
+      = pidTarget - convertToPidInput(Measurer::getBrightness(), isOffsetUsed, isLinearized);
+  TurnPid pid(gain.kp, gain.ki, gain.kd, pidTarget, initDeviation, timeConstant);
+  // 旋回値がモータのPWM値の範囲で飽和した分は偏差の累積に積み上げない
+  pid.setOutputLimit(Controller::MOTOR_PWM_MIN, Controller::MOTOR_PWM_MAX);
 
   // 初期値を代入
   initialDistance = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
@@ -41,16 +70,58 @@ void LineTracing::run()
   initLeftMileage = Mileage::calculateWheelMileage(Measurer::getLeftCount());
   initRightMileage = Mileage::calculateWheelMileage(Measurer::getRightCount());
 
-  SpeedCalculator speedCalculator(targetSpeed);
+  // 速度適応が有効な場合は最低速度から走り始める
+  CurvatureSpeedPlanner speedPlanner(minSpeed, maxSpeed);
+  SpeedCalculator speedCalculator(isSpeedAdaptive ? speedPlanner.getSpeed() : targetSpeed);
+  GainScheduler gainScheduler(gainScheduleLevels);
+  double basePwm = 0.0;  // 旋回値を加える前の左右のPWM値の平均
+  uint64_t prevTime = 0;     // 前回旋回値を計算した時刻[us]
+  bool isFirstCycle = true;  // 旋回値を初めて計算する周期かどうか
+
+  // ラインを見失ったことの検知
+  LineLossDetector lineLossDetector(isLeftEdge);
+  recoveryCount = 0;
+
+  // 車輪のストール・スリップの検知
+  StallDetector stallDetector;
+  retryCount = 0;
 
   // 継続条件を満たしている間ループ
   while(isMetPostcondition()) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
+    // 前回の旋回値計算からの経過時間[s]を求める(初回は制御周期の10ms)
+    uint64_t currentTime = timer.nowMicro();
+    double delta = isFirstCycle ? 0.01 : static_cast<double>(currentTime - prevTime) / 1000000.0;
+    prevTime = currentTime;
+    isFirstCycle = false;
+
+    // 速度適応が有効な場合は、曲率に応じて目標速度を変える
+    if(isSpeedAdaptive) {
+      speedCalculator.setTargetSpeed(speedPlanner.calculateSpeed(turnPwm, basePwm, delta));
+    }
+
     // 初期pwm値を計算
     double baseRightPwm = speedCalculator.calcRightPwmFromSpeed();
     double baseLeftPwm = speedCalculator.calcLeftPwmFromSpeed();
+    basePwm = (baseRightPwm + baseLeftPwm) / 2.0;
+
+    // ゲインスケジュールが有効な場合は、走行速度と曲率に応じてPIDゲインを補間する
+    if(!gainScheduleLevels.empty()) {
+      PidGain scheduledGain = gainScheduler.calculateGain();
+      pid.setPidGain(scheduledGain.kp, scheduledGain.ki, scheduledGain.kd);
+    }
 
     // PIDで旋回値を計算
-    turnPwm = pid.calculatePid(Measurer::getBrightness()) * edgeSign;
+    int brightness = Measurer::getBrightness();
+    double pidInput = convertToPidInput(brightness, isOffsetUsed, isLinearized);
+    turnPwm = static_cast<double>(pid.calculatePid(pidInput, delta)) * edgeSign;
 
     // モータのPWM値をセット（0を超えないようにセット）
     double rightPwm
@@ -60,10 +131,60 @@ void LineTracing::run()
     Controller::setRightMotorPwm(rightPwm);
     Controller::setLeftMotorPwm(leftPwm);
 
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 車輪のストール・スリップを検知した場合は設定に応じて対処する
+    // (旋回値で左右のPWM値が周期ごとに変わり誤検知しやすいため、対処を指定した場合のみ検知する)
+    if(anomalyReaction != ANOMALY_REACTION::CONTINUE) {
+      int prevRetryCount = retryCount;
+      if(!handleDriveAnomaly(stallDetector, stallDetector.update(rightPwm, leftPwm))) {
+        break;
+      }
+      // 待機して再開した場合は、待機時間を旋回値計算の経過時間に含めない
+      if(retryCount != prevRetryCount) {
+        isFirstCycle = true;
+        continue;
+      }
+    }
+
+    // 探し直す設定がある場合はラインを見失ったかを判定し、見失ったら探し直す
+    // 見つからなければ、残りの動作リストを誤った位置から続けないよう失敗として終了する
+    bool isTurnSaturated = basePwm != 0.0 && fabs(turnPwm) >= fabs(basePwm);
+    if(maxRecoveryCount > 0
+       && lineLossDetector.update(targetBrightness - brightness, isTurnSaturated,
+                                  Odometry::getPose().theta, currentTime)) {
+      if(!recoverLine(lineLossDetector, currentTime)) {
+        failed = true;
+        break;
+      }
+      // 見失っている間に溜まった偏差を捨てて走り直す
+      pid = TurnPid(
+          gain.kp, gain.ki, gain.kd, pidTarget,
+          pidTarget - convertToPidInput(Measurer::getBrightness(), isOffsetUsed, isLinearized),
+          timeConstant);
+      pid.setOutputLimit(Controller::MOTOR_PWM_MIN, Controller::MOTOR_PWM_MAX);
+      lineLossDetector.reset();
+      isFirstCycle = true;
+      continue;
+    }
+
     // 10ミリ秒待機
     timer.sleep(10);
   }
 
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
   // モータの停止
   Controller::stopMotor();
 }
@@ -80,4 +201,134 @@ void LineTracing::logRunning()
            "targetBrightness: %d, gain: (%.2f,%.2f,%.2f), isLeftEdge: %s)",
            targetSpeed, targetBrightness, gain.kp, gain.ki, gain.kd, str);
   logger.log(buf);
+}
+
+void LineTracing::setSpeedRange(double _minSpeed, double _maxSpeed)
+{
+  minSpeed = _minSpeed;
+  maxSpeed = _maxSpeed;
+  isSpeedAdaptive = true;
+}
+
+void LineTracing::logGainSchedule()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  // 速度ごとに1行ずつ出す(ゲインスケジュールが無効な場合は何も出さない)
+  for(const GainScheduleLevel& level : gainScheduleLevels) {
+    snprintf(buf, BUF_SIZE,
+             "Gain schedule (speed: %.2f, straightGain: (%.2f,%.2f,%.2f), "
+             "curveGain: (%.2f,%.2f,%.2f))",
+             level.speed, level.straightGain.kp, level.straightGain.ki, level.straightGain.kd,
+             level.curveGain.kp, level.curveGain.ki, level.curveGain.kd);
+    logger.log(buf);
+  }
+}
+
+void LineTracing::logSpeedRange()
+{
+  if(!isSpeedAdaptive) return;
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Adaptive speed (minSpeed: %.2f, maxSpeed: %.2f)", minSpeed, maxSpeed);
+  logger.log(buf);
+}
+
+void LineTracing::setLateralOffsetInput()
+{
+  isOffsetInput = true;
+}
+
+void LineTracing::logOffsetInput()
+{
+  if(!isOffsetInput) return;
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Lateral offset input (targetOffset: %.2fmm)",
+           LateralOffsetEstimator::estimate(targetBrightness));
+  logger.log(buf);
+}
+
+void LineTracing::setLinearizedInput()
+{
+  isLinearizedInput = true;
+}
+
+void LineTracing::logLinearizedInput()
+{
+  if(!isLinearizedInput) return;
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Linearized brightness input (targetBrightness: %.2f)",
+           BrightnessLinearizer::linearize(targetBrightness));
+  logger.log(buf);
+}
+
+void LineTracing::setLineRecovery(int _maxRecoveryCount, double _recoverySweepAngle)
+{
+  maxRecoveryCount = _maxRecoveryCount;
+  recoverySweepAngle = _recoverySweepAngle;
+}
+
+void LineTracing::logLineRecovery()
+{
+  if(maxRecoveryCount <= 0) return;
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE, "Line recovery (maxRecoveryCount: %d, sweepAngle: %.2f)",
+           maxRecoveryCount, recoverySweepAngle);
+  logger.log(buf);
+}
+
+bool LineTracing::recoverLine(LineLossDetector& detector, uint64_t currentTime)
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  int offLineSide = detector.getOffLineSide();
+
+  snprintf(buf, BUF_SIZE,
+           "Line lost (distance: %.1fmm, side: %s, duration: %llu[us], headingChange: %.1f[deg])",
+           Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount())
+               - initialDistance,
+           offLineSide > 0 ? "white" : "black",
+           static_cast<unsigned long long>(detector.getOffLineDuration(currentTime)),
+           detector.getHeadingChange() * 180.0 / M_PI);
+  logger.logWarning(buf);
+
+  if(recoveryCount >= maxRecoveryCount) {
+    logger.logWarning("Abort the commands because the recovery limit is reached");
+    return false;
+  }
+  recoveryCount++;
+
+  // 左エッジで白側に外れた場合は右に、黒側に外れた場合は左にラインの縁がある(右エッジは逆)
+  bool isClockwise = (offLineSide > 0) == isLeftEdge;
+  LoopProfiler::endLoop();
+  LineRecovery lineRecovery(isClockwise, recoverySweepAngle, RECOVERY_PWM, targetBrightness);
+  lineRecovery.run();
+
+  if(!lineRecovery.isFound()) {
+    logger.logWarning("Could not find the line again, so abort the commands");
+    return false;
+  }
+  snprintf(buf, BUF_SIZE, "Line recovered (%d/%d, angle: %.1f[deg])", recoveryCount,
+           maxRecoveryCount, lineRecovery.getFoundAngle());
+  logger.log(buf);
+  return true;
+}
+
+double LineTracing::convertToPidInput(double brightness, bool isOffsetUsed, bool isLinearized)
+{
+  if(isOffsetUsed) return LateralOffsetEstimator::estimate(brightness);
+  if(isLinearized) return BrightnessLinearizer::linearize(brightness);
+  return brightness;
 }
\ No newline at end of file
@@ -12,6 +12,20 @@
 #include "Timer.h"
 #include "Pid.h"
 #include "SpeedCalculator.h"
+#include "GainScheduler.h"
+#include "CurvatureSpeedPlanner.h"
+#include "BrightnessLinearizer.h"
+#include "LateralOffsetEstimator.h"
+#include "LineLossDetector.h"
+#include "LineRecovery.h"
+
+// 旋回値の計算に使うPID(USE_FIXED_POINT_CONTROLを定義すると固定小数点数で計算する)
+// 固定小数点数にするのはこのPIDだけで、速度制御やオドメトリなどは浮動小数点数のまま計算する
+#ifdef USE_FIXED_POINT_CONTROL
+typedef FixedPointPid TurnPid;
+#else
+typedef Pid TurnPid;
+#endif
 
 class LineTracing : public Motion {
  public:
@@ -47,16 +61,108 @@ class LineTracing : public Motion {
    */
   virtual void logRunning();
 
+  /**
+   * @brief ゲインスケジュールに1つの速度でのPIDゲインを加え、速度と曲率に応じた補間を有効にする
+   * @param speed このPIDゲインを使う平均走行速度[mm/s]
+   * @param straightGain 直線でのPIDゲイン
+   * @param curveGain カーブでのPIDゲイン
+   * @note 1つだけ加えた場合は速度によらず曲率だけで補間する。
+   *       有効な場合、コンストラクタで渡したPIDゲインは走り始めの1周期だけ使う
+   */
+  void addGainScheduleLevel(double speed, const PidGain& straightGain, const PidGain& curveGain);
+
+  /**
+   * @brief 目標速度の範囲を設定し、曲率に応じて目標速度を変える速度適応を有効にする
+   * @param _minSpeed カーブでの目標速度[mm/s]
+   * @param _maxSpeed 直線での目標速度[mm/s]
+   */
+  void setSpeedRange(double _minSpeed, double _maxSpeed);
+
+  /**
+   * @brief 輝度から推定したカラーセンサの横ずれ[mm]をPIDの入力にする
+   * @note PIDゲインは横ずれ1mmあたりの旋回値になる。変換表がない場合は輝度のまま入力する
+   */
+  void setLateralOffsetInput();
+
+  /**
+   * @brief キャリブレーションで求めた変換表で線形化した輝度をPIDの入力にする
+   * @note 変換表がない場合は輝度のまま入力する
+   */
+  void setLinearizedInput();
+
+  /**
+   * @brief ラインを見失ったことの検知と、見失ったときに探し直す回数と角度の上限を設定する
+   * @param _maxRecoveryCount 1回の実行で探し直す回数の上限(0以下で検知しない)
+   * @param _recoverySweepAngle 左右それぞれに探す角度[deg]
+   * @note 設定しない場合は検知しない。見つからなければ失敗として残りの動作リストを打ち切る
+   */
+  void setLineRecovery(int _maxRecoveryCount, double _recoverySweepAngle);
+
+  static constexpr int RECOVERY_PWM = 40;  // 探し直すときの回頭のPWM値
+
  protected:
-  double targetSpeed;       // 目標速度 0~
-  int targetBrightness;     // 目標輝度 0~
-  PidGain gain;             // PIDゲイン
-  bool& isLeftEdge;         // エッジの左右判定(true:左エッジ, false:右エッジ)
-  double initLeftMileage;   // クラス呼び出し時の左車輪の走行距離
-  double initRightMileage;  // クラス呼び出し時の右車輪の走行距離
-  double initialDistance;   // 実行前の走行距離
-  double currentDistance;   // 現在の走行距離
+  double targetSpeed;         // 目標速度 0~
+  int targetBrightness;       // 目標輝度 0~
+  PidGain gain;               // PIDゲイン
+  // ゲインスケジュールの速度ごとのPIDゲイン(空の場合はゲインスケジュールを使わずgainで固定)
+  std::vector<GainScheduleLevel> gainScheduleLevels;
+  double minSpeed;            // 速度適応有効時のカーブでの目標速度
+  double maxSpeed;            // 速度適応有効時の直線での目標速度
+  bool isSpeedAdaptive;       // true:曲率に応じて目標速度を変える, false:targetSpeedで固定
+  bool isOffsetInput;         // true:横ずれをPIDの入力にする, false:輝度を入力にする
+  bool isLinearizedInput;     // true:線形化した輝度をPIDの入力にする, false:輝度のまま入力する
+  int maxRecoveryCount;       // ラインを見失ったときに探し直す回数の上限(0以下で検知しない)
+  double recoverySweepAngle;  // ラインを探し直すときに左右それぞれに探す角度[deg]
+  int recoveryCount;          // 実行中にラインを探し直した回数
+  bool& isLeftEdge;           // エッジの左右判定(true:左エッジ, false:右エッジ)
+  double initLeftMileage;     // クラス呼び出し時の左車輪の走行距離
+  double initRightMileage;    // クラス呼び出し時の右車輪の走行距離
+  double initialDistance;     // 実行前の走行距離
+  double currentDistance;     // 現在の走行距離
   Timer timer;
+
+  /**
+   * @brief ゲインスケジュールが有効な場合はその設定のログを取る
+   */
+  void logGainSchedule();
+
+  /**
+   * @brief 速度適応が有効な場合はその設定のログを取る
+   */
+  void logSpeedRange();
+
+  /**
+   * @brief 横ずれを入力にする場合はその設定のログを取る
+   */
+  void logOffsetInput();
+
+  /**
+   * @brief 線形化した輝度を入力にする場合はその設定のログを取る
+   */
+  void logLinearizedInput();
+
+  /**
+   * @brief ラインを見失ったときに探し直す場合はその設定のログを取る
+   */
+  void logLineRecovery();
+
+ private:
+  /**
+   * @brief 輝度をPIDの入力に変換する
+   * @param brightness 輝度
+   * @param isOffsetUsed true:横ずれに変換する, false:輝度のまま使う
+   * @param isLinearized true:横ずれに変換しない場合に線形化する, false:線形化しない
+   * @return PIDの入力
+   */
+  static double convertToPidInput(double brightness, bool isOffsetUsed, bool isLinearized);
+
+  /**
+   * @brief ラインを見失ったことをログに出し、上限の範囲でラインを探し直す
+   * @param detector ラインを見失ったことを検知したLineLossDetector
+   * @param currentTime 現在時刻[us]
+   * @return true:ラインを見つけた, false:見つからない(上限に達した場合を含む)
+   */
+  bool recoverLine(LineLossDetector& detector, uint64_t currentTime);
 };
 
 #endif
\ No newline at end of file
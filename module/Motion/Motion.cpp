@@ -6,4 +6,84 @@
 
 #include "Motion.h"
 
-Motion::Motion(){};
\ No newline at end of file
+Motion::Motion()
+  : anomalyReaction(ANOMALY_REACTION::CONTINUE),
+    retryCount(0),
+    timeLimit(0),
+    distanceLimit(0.0),
+    watchdogReaction(WATCHDOG_REACTION::CONTINUE),
+    failed(false){};
+
+void Motion::setAnomalyReaction(ANOMALY_REACTION reaction)
+{
+  anomalyReaction = reaction;
+}
+
+ANOMALY_REACTION Motion::getAnomalyReaction()
+{
+  return anomalyReaction;
+}
+
+void Motion::setWatchdogLimit(int _timeLimit, double _distanceLimit,
+                              WATCHDOG_REACTION _watchdogReaction)
+{
+  timeLimit = _timeLimit;
+  distanceLimit = _distanceLimit;
+  watchdogReaction = _watchdogReaction;
+}
+
+int Motion::getTimeLimit()
+{
+  return timeLimit;
+}
+
+double Motion::getDistanceLimit()
+{
+  return distanceLimit;
+}
+
+WATCHDOG_REACTION Motion::getWatchdogReaction()
+{
+  return watchdogReaction;
+}
+
+bool Motion::isFailed()
+{
+  return failed;
+}
+
+bool Motion::resume()
+{
+  return false;
+}
+
+bool Motion::handleDriveAnomaly(StallDetector& detector, DRIVE_ANOMALY anomaly)
+{
+  // 異常がない場合はそのまま続ける
+  if(anomaly == DRIVE_ANOMALY::NONE) return true;
+
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  snprintf(buf, BUF_SIZE, "%s detected (time: %llu[us], rightPwm: %.1f, leftPwm: %.1f)",
+           StallDetector::anomalyToString(anomaly),
+           static_cast<unsigned long long>(detector.getLastAnomalyTime()),
+           Controller::getRightPwm(), Controller::getLeftPwm());
+  logger.logWarning(buf);
+
+  if(anomalyReaction == ANOMALY_REACTION::ABORT) {  // 動作を打ち切る
+    logger.logWarning("Abort the motion");
+    return false;
+  } else if(anomalyReaction == ANOMALY_REACTION::RETRY) {  // 待機した後に再開する
+    if(retryCount >= MAX_RETRY_COUNT) {
+      logger.logWarning("Abort the motion because the retry limit is reached");
+      return false;
+    }
+    retryCount++;
+    snprintf(buf, BUF_SIZE, "Retry the motion (%d/%d)", retryCount, MAX_RETRY_COUNT);
+    logger.logWarning(buf);
+    Controller::stopMotor();
+    CooperativeScheduler::sleep(RETRY_WAIT_TIME);
+    detector.reset();
+  }
+  return true;
+}
\ No newline at end of file
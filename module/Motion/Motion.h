@@ -10,8 +10,15 @@
 #include "Measurer.h"
 #include "Controller.h"
 #include "Logger.h"
+#include "TelemetryRecorder.h"
+#include "LoopProfiler.h"
+#include "Odometry.h"
+#include "StallDetector.h"
+#include "MotionWatchdog.h"
+#include "Timer.h"
+#include "CooperativeScheduler.h"
 
-class Motion {
+class Motion : public CooperativeTask {
  public:
   /**
    * コンストラクタ
@@ -28,8 +35,78 @@ class Motion {
    */
   virtual void logRunning() = 0;
 
+  /**
+   * @brief 車輪のストール・スリップを検知したときの対処を設定する
+   * @param reaction 異常を検知したときの対処
+   */
+  void setAnomalyReaction(ANOMALY_REACTION reaction);
+
+  /**
+   * @brief 車輪のストール・スリップを検知したときの対処を取得する
+   * @return 異常を検知したときの対処
+   */
+  ANOMALY_REACTION getAnomalyReaction();
+
+  /**
+   * @brief 動作の制限時間・制限距離と、超えたときの対処を設定する
+   * @param _timeLimit 制限時間[ms](0以下の場合は制限しない)
+   * @param _distanceLimit 制限距離[mm](0以下の場合は制限しない)
+   * @param _watchdogReaction 制限を超えたときの動作リストの対処
+   * @note 設定しない場合は動作の種類ごとの既定値を使う
+   */
+  void setWatchdogLimit(int _timeLimit, double _distanceLimit,
+                        WATCHDOG_REACTION _watchdogReaction = WATCHDOG_REACTION::CONTINUE);
+
+  /**
+   * @brief 制限時間を取得する
+   * @return 制限時間[ms](0以下の場合は制限しない)
+   */
+  int getTimeLimit();
+
+  /**
+   * @brief 制限距離を取得する
+   * @return 制限距離[mm](0以下の場合は制限しない)
+   */
+  double getDistanceLimit();
+
+  /**
+   * @brief 制限を超えたときの動作リストの対処を取得する
+   * @return 制限を超えたときの動作リストの対処
+   */
+  WATCHDOG_REACTION getWatchdogReaction();
+
+  /**
+   * @brief 直前の実行で動作が目的を果たせずに打ち切られたかを取得する
+   * @return true:打ち切られた(残りの動作リストは実行しない), false:打ち切られていない
+   */
+  bool isFailed();
+
+  /**
+   * @brief 他の動作の制御ループの中で、この動作を1制御周期分だけ進める
+   * @return true:動作を続ける, false:動作が終わった(再開可能な実行に対応していない場合を含む)
+   * @note CooperativeSchedulerに登録して並行に進める動作はオーバーライドする
+   */
+  bool resume() override;
+
  protected:
   Logger logger;
+  ANOMALY_REACTION anomalyReaction;            // 異常を検知したときの対処
+  int retryCount;                              // 動作中に異常から再開した回数
+  int timeLimit;                               // 制限時間[ms](0以下の場合は制限しない)
+  double distanceLimit;                        // 制限距離[mm](0以下の場合は制限しない)
+  WATCHDOG_REACTION watchdogReaction;          // 制限を超えたときの動作リストの対処
+  bool failed;                                 // true:直前の実行で目的を果たせずに打ち切られた
+  static constexpr int MAX_RETRY_COUNT = 2;    // 異常から再開する回数の上限
+  static constexpr int RETRY_WAIT_TIME = 300;  // 異常から再開するまでの待機時間[ms]
+
+  /**
+   * @brief 検知した異常をログに出し、設定に応じて対処する
+   * @param detector 異常を検知したStallDetector
+   * @param anomaly 検知した異常
+   * @return true:動作を続ける, false:動作を打ち切る
+   * @note 動作の開始時にretryCountを0に戻しておく
+   */
+  bool handleDriveAnomaly(StallDetector& detector, DRIVE_ANOMALY anomaly);
 };
 
 #endif
\ No newline at end of file
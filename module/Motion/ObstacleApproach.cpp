@@ -0,0 +1,153 @@
+/**
+ * @file   ObstacleApproach.cpp
+ * @brief  前方の障害物に近づき、指定した距離で止まる動作
+ * @author KatLab
+ */
+
+#include "ObstacleApproach.h"
+using namespace std;
+
+ObstacleApproach::ObstacleApproach(double _targetSpeed, int _stopDistance, int _slowDistance,
+                                   double _maxDistance)
+  : targetSpeed(_targetSpeed),
+    stopDistance(_stopDistance),
+    slowDistance(_slowDistance),
+    maxDistance(_maxDistance),
+    reached(false)
+{
+}
+
+void ObstacleApproach::run()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  reached = false;
+
+  // 事前条件を判定する
+  if(!isMetPrecondition()) {
+    return;
+  }
+
+  double initialDistance
+      = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+  int distance = SonarSampler::getDistance();
+  SpeedCalculator speedCalculator(calcApproachSpeed(distance));
+
+  // 障害物までの距離がstopDistance以下になるまでループ
+  while(true) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    distance = SonarSampler::getDistance();
+    if(distance <= stopDistance) {
+      reached = true;
+      break;
+    }
+    // 障害物が見つからないまま走りすぎた場合は打ち切る
+    double currentDistance
+        = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+    if(fabs(currentDistance - initialDistance) >= maxDistance) {
+      snprintf(buf, BUF_SIZE, "ObstacleApproach did not find an obstacle within %.2fmm",
+               maxDistance);
+      logger.logWarning(buf);
+      break;
+    }
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
+    // 障害物までの距離に応じて目標速度を下げる
+    speedCalculator.setTargetSpeed(calcApproachSpeed(distance));
+
+    // モータにPWM値をセット
+    Controller::setRightMotorPwm(speedCalculator.calcRightPwmFromSpeed());
+    Controller::setLeftMotorPwm(speedCalculator.calcLeftPwmFromSpeed());
+
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 10ミリ秒待機
+    timer.sleep(10);
+  }
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
+  // モータの停止
+  Controller::stopMotor();
+}
+
+double ObstacleApproach::calcApproachSpeed(int distance)
+{
+  double minSpeed = min(MIN_SPEED, targetSpeed);
+  if(distance >= slowDistance || slowDistance <= stopDistance) return targetSpeed;
+  if(distance <= stopDistance) return minSpeed;
+
+  // slowDistanceからstopDistanceにかけて線形に減速する
+  double ratio = static_cast<double>(distance - stopDistance) / (slowDistance - stopDistance);
+  return minSpeed + (targetSpeed - minSpeed) * ratio;
+}
+
+bool ObstacleApproach::isReached()
+{
+  return reached;
+}
+
+bool ObstacleApproach::isMetPrecondition()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];
+
+  // targetSpeed値が0以下の場合はwarningを出して終了する
+  if(targetSpeed <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The targetSpeed value passed to ObstacleApproach is %.2f",
+             targetSpeed);
+    logger.logWarning(buf);
+    return false;
+  }
+  // stopDistanceが負の場合はwarningを出して終了する
+  if(stopDistance < 0) {
+    snprintf(buf, BUF_SIZE, "The stopDistance value passed to ObstacleApproach is %d",
+             stopDistance);
+    logger.logWarning(buf);
+    return false;
+  }
+  // slowDistanceがstopDistanceより小さい場合はwarningを出して終了する
+  if(slowDistance < stopDistance) {
+    snprintf(buf, BUF_SIZE, "The slowDistance value passed to ObstacleApproach is %d",
+             slowDistance);
+    logger.logWarning(buf);
+    return false;
+  }
+  // maxDistanceが0以下の場合はwarningを出して終了する
+  if(maxDistance <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The maxDistance value passed to ObstacleApproach is %.2f",
+             maxDistance);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  return true;
+}
+
+void ObstacleApproach::logRunning()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE,
+           "Run ObstacleApproach (targetSpeed: %.2f, stopDistance: %d, slowDistance: %d, "
+           "maxDistance: %.2f)",
+           targetSpeed, stopDistance, slowDistance, maxDistance);
+  logger.log(buf);
+}
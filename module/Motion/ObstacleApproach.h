@@ -0,0 +1,68 @@
+/**
+ * @file   ObstacleApproach.h
+ * @brief  前方の障害物に近づき、指定した距離で止まる動作
+ * @author KatLab
+ */
+
+#ifndef OBSTACLE_APPROACH_H
+#define OBSTACLE_APPROACH_H
+
+#include "Motion.h"
+#include "Mileage.h"
+#include "SpeedCalculator.h"
+#include "SonarSampler.h"
+
+class ObstacleApproach : public Motion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _targetSpeed 目標速度[mm/s](0より大きい)
+   * @param _stopDistance 止まる障害物までの距離[mm]
+   * @param _slowDistance 減速を始める障害物までの距離[mm](_stopDistance以上)
+   * @param _maxDistance 障害物が見つからないときに打ち切る走行距離[mm]
+   */
+  ObstacleApproach(double _targetSpeed, int _stopDistance, int _slowDistance,
+                   double _maxDistance);
+
+  /**
+   * @brief 障害物までの距離がstopDistance以下になるまで直進する
+   * @note 障害物までの距離はSonarSamplerが保持している値を使い、周期ごとにセンサへ問い合わせない
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+  /**
+   * @brief 障害物までの距離に応じた目標速度を求める
+   * @param distance 障害物までの距離[mm]
+   * @return 目標速度[mm/s](slowDistanceからstopDistanceにかけてMIN_SPEEDまで線形に下げる)
+   */
+  double calcApproachSpeed(int distance);
+
+  /**
+   * @brief 障害物の手前で止まったかを取得する
+   * @return true:止まった, false:止まっていない(打ち切った場合を含む)
+   */
+  bool isReached();
+
+  static constexpr double MIN_SPEED = 50.0;  // 止まる直前の目標速度[mm/s]
+
+ private:
+  double targetSpeed;  // 目標速度[mm/s]
+  int stopDistance;    // 止まる障害物までの距離[mm]
+  int slowDistance;    // 減速を始める障害物までの距離[mm]
+  double maxDistance;  // 打ち切る走行距離[mm]
+  bool reached;         // true:障害物の手前で止まった, false:止まっていない
+  Timer timer;
+
+  /**
+   * @brief 事前条件を判定する
+   * @return true:実行できる, false:実行できない
+   */
+  bool isMetPrecondition();
+};
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ * @file   ParallelMotion.cpp
+ * @brief  走行動作とアーム動作を並行して行う合成動作
+ * @author KatLab
+ */
+
+#include "ParallelMotion.h"
+
+ParallelMotion::ParallelMotion(Motion& _driveMotion, ArmMotion& _armMotion)
+  : driveMotion(_driveMotion), armMotion(_armMotion)
+{
+}
+
+void ParallelMotion::run()
+{
+  // アーム動作を開始し、スケジューラに登録して走行動作の制御ループの中で進めさせる
+  if(!armMotion.begin()) {
+    driveMotion.run();
+    return;
+  }
+  if(!CooperativeScheduler::add(&armMotion)) {
+    logger.logWarning("ArmMotion cannot be scheduled, so the motions run in sequence");
+    driveMotion.run();
+    armMotion.run();
+    return;
+  }
+  driveMotion.run();
+
+  // 制限時間・制限距離を超えて走行動作を打ち切った場合は、アーム動作も打ち切る
+  if(MotionWatchdog::isExpired()) {
+    CooperativeScheduler::remove(&armMotion);
+    Controller::stopArmMotor();
+    return;
+  }
+
+  // 走行動作が先に終わった場合は、アーム動作が終わるまで待つ
+  CooperativeScheduler::runUntilFinished(&armMotion);
+}
+
+void ParallelMotion::logRunning()
+{
+  logger.log("Run ParallelMotion");
+  driveMotion.logRunning();
+  armMotion.logRunning();
+}
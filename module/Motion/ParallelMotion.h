@@ -0,0 +1,38 @@
+/**
+ * @file   ParallelMotion.h
+ * @brief  走行動作とアーム動作を並行して行う合成動作
+ * @author KatLab
+ */
+
+#ifndef PARALLEL_MOTION_H
+#define PARALLEL_MOTION_H
+
+#include "CompositeMotion.h"
+#include "ArmMotion.h"
+
+class ParallelMotion : public CompositeMotion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _driveMotion 走行動作
+   * @param _armMotion 走行と並行して行うアーム動作
+   */
+  ParallelMotion(Motion& _driveMotion, ArmMotion& _armMotion);
+
+  /**
+   * @brief 走行動作の制御ループの中でアーム動作を進め、両方が終わるまで待つ
+   * @note 走行動作が先に終わった場合は、アーム動作が終わるまで単独で制御ループを回す
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+ private:
+  Motion& driveMotion;
+  ArmMotion& armMotion;
+};
+
+#endif
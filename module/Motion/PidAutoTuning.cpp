@@ -0,0 +1,168 @@
+/**
+ * @file   PidAutoTuning.cpp
+ * @brief  リレーフィードバック試験でライントレースのPIDゲインを調整する動作
+ * @author KatLab
+ */
+
+#include "PidAutoTuning.h"
+using namespace std;
+
+PidAutoTuning::PidAutoTuning(double _maxDistance, double _targetSpeed, int _targetBrightness,
+                             double _relayPwm, TUNING_RULE _rule, const char* _gainName,
+                             bool& _isLeftEdge)
+  : maxDistance(_maxDistance),
+    targetSpeed(_targetSpeed),
+    targetBrightness(_targetBrightness),
+    relayPwm(_relayPwm),
+    rule(_rule),
+    gainName(_gainName),
+    isLeftEdge(_isLeftEdge),
+    tunedGain(0.0, 0.0, 0.0)
+{
+}
+
+void PidAutoTuning::run()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  // 事前条件を判定する
+  if(!isMetPrecondition()) {
+    return;
+  }
+
+  // 左右で符号を変える
+  int edgeSign = isLeftEdge ? -1 : 1;
+  double initialDistance
+      = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+
+  RelayAutoTuner tuner(targetBrightness, relayPwm, RELAY_HYSTERESIS);
+  SpeedCalculator speedCalculator(targetSpeed);
+
+  // 振動を計測し終えるか、最大距離に到達するまでループ
+  while(!tuner.isFinished()) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    double currentDistance
+        = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+    if(fabs(currentDistance - initialDistance) >= maxDistance) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
+    // 初期pwm値を計算
+    double baseRightPwm = speedCalculator.calcRightPwmFromSpeed();
+    double baseLeftPwm = speedCalculator.calcLeftPwmFromSpeed();
+
+    // PIDの代わりにリレー出力で旋回値を決める
+    double turnPwm = tuner.update(Measurer::getBrightness(), timer.nowMicro()) * edgeSign;
+
+    // モータのPWM値をセット（0を超えないようにセット）
+    double rightPwm
+        = baseRightPwm > 0.0 ? max(baseRightPwm - turnPwm, 0.0) : min(baseRightPwm + turnPwm, 0.0);
+    double leftPwm
+        = baseLeftPwm > 0.0 ? max(baseLeftPwm + turnPwm, 0.0) : min(baseLeftPwm - turnPwm, 0.0);
+    Controller::setRightMotorPwm(rightPwm);
+    Controller::setLeftMotorPwm(leftPwm);
+
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 10ミリ秒待機
+    timer.sleep(10);
+  }
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
+  // モータの停止
+  Controller::stopMotor();
+
+  // 最大距離までに振動を計測しきれなかった場合はPIDゲインを求めない
+  if(!tuner.isFinished()) {
+    snprintf(buf, BUF_SIZE,
+             "PidAutoTuning could not measure the oscillation within %.2fmm (relayPwm: %.2f)",
+             maxDistance, relayPwm);
+    logger.logWarning(buf);
+    return;
+  }
+
+  // 限界ゲインと限界周期から調整則に従ってPIDゲインを求める
+  double ultimateGain = tuner.getUltimateGain();
+  double ultimatePeriod = tuner.getUltimatePeriod();
+  tunedGain = RelayAutoTuner::calcGain(ultimateGain, ultimatePeriod, rule);
+  snprintf(buf, BUF_SIZE,
+           "Tuned PID gain (Ku: %.4f, Tu: %.4f[s], amplitude: %.2f, rule: %s, "
+           "gain: (%.4f,%.4f,%.4f))",
+           ultimateGain, ultimatePeriod, tuner.getAmplitude(), RelayAutoTuner::ruleToString(rule),
+           tunedGain.kp, tunedGain.ki, tunedGain.kd);
+  logger.logHighlight(buf);
+
+  // 名前が指定されている場合は、以降の走行で使えるようゲインファイルに保存する
+  if(!gainName.empty()) {
+    PidGainStore::setGain(gainName.c_str(), tunedGain);
+    PidGainStore::save();
+  }
+}
+
+bool PidAutoTuning::isMetPrecondition()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];
+
+  // targetSpeed値が0以下の場合はwarningを出して終了する
+  if(targetSpeed <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The targetSpeed value passed to PidAutoTuning is %.2f",
+             targetSpeed);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  // maxDistance値が0以下の場合はwarningを出して終了する
+  if(maxDistance <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The maxDistance value passed to PidAutoTuning is %.2f", maxDistance);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  // relayPwm値が0以下の場合はwarningを出して終了する
+  if(relayPwm <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The relayPwm value passed to PidAutoTuning is %.2f", relayPwm);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  return true;
+}
+
+void PidAutoTuning::logRunning()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  const char* str = isLeftEdge ? "true" : "false";
+
+  snprintf(buf, BUF_SIZE,
+           "Run PidAutoTuning (maxDistance: %.2f, targetSpeed: %.2f, targetBrightness: %d, "
+           "relayPwm: %.2f, rule: %s, gainName: %s, isLeftEdge: %s)",
+           maxDistance, targetSpeed, targetBrightness, relayPwm,
+           RelayAutoTuner::ruleToString(rule), gainName.empty() ? "none" : gainName.c_str(),
+           str);
+  logger.log(buf);
+}
+
+PidGain PidAutoTuning::getTunedGain()
+{
+  return tunedGain;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file   PidAutoTuning.h
+ * @brief  リレーフィードバック試験でライントレースのPIDゲインを調整する動作
+ * @author KatLab
+ */
+
+#ifndef PID_AUTO_TUNING_H
+#define PID_AUTO_TUNING_H
+
+#include <string>
+#include "Motion.h"
+#include "Mileage.h"
+#include "Timer.h"
+#include "SpeedCalculator.h"
+#include "RelayAutoTuner.h"
+#include "PidGainStore.h"
+
+class PidAutoTuning : public Motion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _maxDistance 調整に使う最大距離[mm](計測が終わらなくてもこの距離で打ち切る)
+   * @param _targetSpeed 目標速度[mm/s]
+   * @param _targetBrightness 目標輝度 0~
+   * @param _relayPwm リレー出力とする旋回値の大きさ
+   * @param _rule PIDゲインを求める調整則
+   * @param _gainName 求めたPIDゲインを保存する名前(空文字列の場合は保存しない)
+   * @param _isLeftEdge エッジの左右判定(true:左エッジ, false:右エッジ)
+   */
+  PidAutoTuning(double _maxDistance, double _targetSpeed, int _targetBrightness, double _relayPwm,
+                TUNING_RULE _rule, const char* _gainName, bool& _isLeftEdge);
+
+  /**
+   * @brief 旋回値をリレー出力にしてライントレースし、振動からPIDゲインを求める
+   */
+  void run() override;
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+  /**
+   * @brief 求めたPIDゲインを取得する
+   * @return 求めたPIDゲイン(計測が終わっていない場合は全て0)
+   */
+  PidGain getTunedGain();
+
+  static constexpr double RELAY_HYSTERESIS = 3.0;  // リレーを切り替える輝度の偏差の幅
+
+ private:
+  double maxDistance;     // 調整に使う最大距離[mm]
+  double targetSpeed;     // 目標速度[mm/s]
+  int targetBrightness;   // 目標輝度 0~
+  double relayPwm;        // リレー出力とする旋回値の大きさ
+  TUNING_RULE rule;       // PIDゲインを求める調整則
+  std::string gainName;   // 求めたPIDゲインを保存する名前
+  bool& isLeftEdge;       // エッジの左右判定(true:左エッジ, false:右エッジ)
+  PidGain tunedGain;      // 求めたPIDゲイン
+  Timer timer;
+
+  /**
+   * @brief 事前条件を判定する
+   * @return true:調整を始める, false:調整しない
+   */
+  bool isMetPrecondition();
+};
+
+#endif
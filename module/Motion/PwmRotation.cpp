@@ -11,6 +11,7 @@ using namespace std;
 PwmRotation::PwmRotation(int _angle, int _pwm, bool _isClockwise)
   : angle(_angle), pwm(_pwm), isClockwise(_isClockwise)
 {
+  setWatchdogLimit(DEFAULT_TIME_LIMIT, 0.0);
 }
 
 void PwmRotation::run()
@@ -42,8 +43,20 @@ void PwmRotation::run()
   double targetRightDistance
       = Mileage::calculateWheelMileage(Measurer::getRightCount()) + targetDistance * rightSign;
 
+  // 車輪のストール・スリップの検知
+  StallDetector stallDetector;
+  retryCount = 0;
+
   // 両輪が目標距離に到達するまでループ
   while(leftSign != 0 || rightSign != 0) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
     // 残りの移動距離
     double diffLeftDistance
         = (targetLeftDistance - Mileage::calculateWheelMileage(Measurer::getLeftCount()))
@@ -64,10 +77,31 @@ void PwmRotation::run()
     Controller::setLeftMotorPwm(pwm * leftSign);
     Controller::setRightMotorPwm(pwm * rightSign);
 
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 車輪のストール・スリップを検知した場合は設定に応じて対処する
+    if(!handleDriveAnomaly(stallDetector,
+                           stallDetector.update(pwm * rightSign, pwm * leftSign))) {
+      break;
+    }
+
     // 10ミリ秒待機
     timer.sleep();
   }
 
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
   // モータの停止
   Controller::stopMotor();
 }
@@ -32,6 +32,9 @@ class PwmRotation : public Motion {
    */
   void logRunning();
 
+  // 車輪が拘束されたまま回頭し続けないための既定の制限時間[ms]
+  static constexpr int DEFAULT_TIME_LIMIT = 5000;
+
  private:
   int angle;         // 回転角度(deg) 0~360
   int pwm;           // PWM値 0~100
@@ -11,6 +11,7 @@ using namespace std;
 Rotation::Rotation(double _targetSpeed, bool _isClockwise)
   : targetSpeed(_targetSpeed), isClockwise(_isClockwise)
 {
+  setWatchdogLimit(DEFAULT_TIME_LIMIT, 0.0);
 }
 
 void Rotation::run()
@@ -31,8 +32,20 @@ void Rotation::run()
 
   SpeedCalculator speedCalculator(targetSpeed * rightSign, targetSpeed * leftSign);
 
+  // 車輪のストール・スリップの検知
+  StallDetector stallDetector;
+  retryCount = 0;
+
   // 継続条件を満たしている間ループ
   while(isMetPostcondition(initLeftMileage, initRightMileage, leftSign, rightSign)) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+
     // PWM値を設定する
     double leftPwm = speedCalculator.calcLeftPwmFromSpeed();
     double rightPwm = speedCalculator.calcRightPwmFromSpeed();
@@ -41,10 +54,30 @@ void Rotation::run()
     Controller::setLeftMotorPwm(leftPwm);
     Controller::setRightMotorPwm(rightPwm);
 
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 車輪のストール・スリップを検知した場合は設定に応じて対処する
+    if(!handleDriveAnomaly(stallDetector, stallDetector.update(rightPwm, leftPwm))) {
+      break;
+    }
+
     // 10ミリ秒待機
     timer.sleep(10);
   }
 
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
   // モータの停止
   Controller::stopMotor();
 }
\ No newline at end of file
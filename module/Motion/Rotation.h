@@ -50,6 +50,9 @@ class Rotation : public Motion {
    */
   virtual void logRunning() = 0;
 
+  // 車輪が拘束されたまま回頭し続けないための既定の制限時間[ms]
+  static constexpr int DEFAULT_TIME_LIMIT = 5000;
+
  protected:
   double targetSpeed;  // 目標速度
   bool isClockwise;    // 回頭方向 true:時計回り, false:反時計回り
@@ -5,13 +5,13 @@
  */
 
 #include "Sleeping.h"
-#include "Timer.h"
 
 Sleeping::Sleeping(int _milliSec) : milliSec(_milliSec) {}
 
 void Sleeping::run()
 {
-  timer.sleep(milliSec);
+  // スリープ中もスケジューラに登録された動作(アーム動作など)は進める
+  CooperativeScheduler::sleep(milliSec);
 }
 
 void Sleeping::logRunning()
@@ -30,7 +30,6 @@ class Sleeping : public Motion {
 
  private:
   int milliSec;
-  Timer timer;
 };
 
 #endif
\ No newline at end of file
@@ -34,12 +34,23 @@ void Straight::run()
   double currentLeftPwm = 0.0;   // 現在の左タイヤpwd値
   double currentRightPwm = 0.0;  // 現在の右タイヤpwd値
 
+  // 車輪のストール・スリップの検知
+  StallDetector stallDetector;
+  retryCount = 0;
+
   // 走行距離が目標値に到達するまで繰り返す
   while(true) {
     // 終了条件が満たされたときループから抜ける オーバーライド必須
     if(isRunPostconditionJudgement() == true) {
       break;
     }
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
 
     // PWM値を目標速度値に合わせる
     currentLeftPwm = SpeedCalculator.calcLeftPwmFromSpeed();
@@ -49,9 +60,29 @@ void Straight::run()
     Controller::setLeftMotorPwm(currentLeftPwm);
     Controller::setRightMotorPwm(currentRightPwm);
 
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 車輪のストール・スリップを検知した場合は設定に応じて対処する
+    if(!handleDriveAnomaly(stallDetector, stallDetector.update(currentRightPwm, currentLeftPwm))) {
+      break;
+    }
+
     // 10ミリ秒待機
     timer.sleep(10);
   }
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+
+  // 終了判定時の走行データを記録する
+  TelemetryRecorder::record(true);
+
   // モータの停止
   Controller::stopMotor();
 }
@@ -0,0 +1,53 @@
+/**
+ * @file   SweepRotation.cpp
+ * @brief  その場で回頭しながら制御周期ごとに輝度を調べる動作の中間クラス
+ * @author KatLab
+ */
+
+#include "SweepRotation.h"
+using namespace std;
+
+SweepRotation::SweepRotation(int _pwm) : pwm(_pwm)
+{
+}
+
+int SweepRotation::rotateToAngle(double initialTheta, double targetAngle, int maxCycleCount)
+{
+  Odometry::update();
+  double angle = Odometry::normalizeAngle(Odometry::getPose().theta - initialTheta);
+  int direction = targetAngle > angle ? 1 : -1;  // 1:反時計回り, -1:時計回り
+  int cycleCount = 0;
+
+  // 目標の回頭角に達するまでループ
+  while((targetAngle - angle) * direction > 0.0 && cycleCount < maxCycleCount) {
+    // 制限時間・制限距離を超えたときはループから抜ける
+    if(MotionWatchdog::isExpired()) break;
+
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+    // 走行体の位置と向きを更新する
+    Odometry::update();
+    angle = Odometry::normalizeAngle(Odometry::getPose().theta - initialTheta);
+    cycleCount++;
+
+    // 回頭角に応じて輝度を調べ、派生クラスが回頭をやめると判断したらループから抜ける
+    if(!sampleBrightness(angle)) break;
+
+    // モータにPWM値をセット
+    Controller::setRightMotorPwm(pwm * direction);
+    Controller::setLeftMotorPwm(-pwm * direction);
+
+    // スケジューラに登録された動作(アーム動作など)を1制御周期分だけ進める
+    CooperativeScheduler::tick();
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 走行データを記録する
+    TelemetryRecorder::record();
+
+    // 10ミリ秒待機
+    timer.sleep(10);
+  }
+  return cycleCount;
+}
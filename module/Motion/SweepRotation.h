@@ -0,0 +1,42 @@
+/**
+ * @file   SweepRotation.h
+ * @brief  その場で回頭しながら制御周期ごとに輝度を調べる動作の中間クラス
+ * @author KatLab
+ */
+
+#ifndef SWEEP_ROTATION_H
+#define SWEEP_ROTATION_H
+
+#include "Motion.h"
+
+class SweepRotation : public Motion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _pwm 回頭のPWM値(0より大きい)
+   */
+  SweepRotation(int _pwm);
+
+ protected:
+  int pwm;  // 回頭のPWM値
+  Timer timer;
+
+  /**
+   * @brief 初期の向きからの回頭角が目標に達するか、sampleBrightness()がfalseを返すまで回頭する
+   * @param initialTheta 初期の向き[rad]
+   * @param targetAngle 初期の向きからの目標の回頭角[rad](反時計回りが正)
+   * @param maxCycleCount 制御周期の上限
+   * @return 回頭した制御周期の数(sampleBrightness()を呼び出した回数)
+   */
+  int rotateToAngle(double initialTheta, double targetAngle, int maxCycleCount);
+
+  /**
+   * @brief 回頭中の制御周期ごとに輝度を調べる
+   * @param angle 初期の向きからの回頭角[rad](反時計回りが正)
+   * @return true:回頭を続ける, false:回頭をやめる
+   * @note オーバーライド必須
+   */
+  virtual bool sampleBrightness(double angle) = 0;
+};
+
+#endif
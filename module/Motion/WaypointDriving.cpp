@@ -0,0 +1,80 @@
+/**
+ * @file   WaypointDriving.cpp
+ * @brief  指定座標まで走行する合成動作
+ * @author KatLab
+ */
+
+#include "WaypointDriving.h"
+
+using namespace std;
+
+WaypointDriving::WaypointDriving(double _targetX, double _targetY, double _targetSpeed,
+                                 double _rotationSpeed)
+  : targetX(_targetX), targetY(_targetY), targetSpeed(_targetSpeed), rotationSpeed(_rotationSpeed)
+{
+}
+
+void WaypointDriving::run()
+{
+  // 事前条件を判定する
+  if(!isMetPrecondition()) {
+    return;
+  }
+
+  // すでに目標座標にいる場合は走行しない
+  Odometry::update();
+  if(Odometry::calcDistanceTo(targetX, targetY) < NO_DRIVING_DISTANCE) {
+    return;
+  }
+
+  // 目標座標の方向に回頭する
+  Pose pose = Odometry::getPose();
+  double heading = atan2(targetY - pose.y, targetX - pose.x) * 180.0 / M_PI;
+  HeadingRotation hr(heading, rotationSpeed);
+  hr.run();
+
+  // 回頭後の位置から目標座標まで直進する
+  Odometry::update();
+  double distance = Odometry::calcDistanceTo(targetX, targetY);
+  if(distance < NO_DRIVING_DISTANCE) {
+    return;
+  }
+  DistanceStraight ds(distance, targetSpeed);
+  ds.run();
+}
+
+bool WaypointDriving::isMetPrecondition()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];
+
+  // targetSpeed値が0以下の場合はwarningを出して終了する
+  if(targetSpeed <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The targetSpeed value passed to WaypointDriving is %.2f",
+             targetSpeed);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  // rotationSpeed値が0以下の場合はwarningを出して終了する
+  if(rotationSpeed <= 0.0) {
+    snprintf(buf, BUF_SIZE, "The rotationSpeed value passed to WaypointDriving is %.2f",
+             rotationSpeed);
+    logger.logWarning(buf);
+    return false;
+  }
+
+  return true;
+}
+
+void WaypointDriving::logRunning()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+
+  snprintf(buf, BUF_SIZE,
+           "Run WaypointDriving (targetX: %.2f, targetY: %.2f, targetSpeed: %.2f, "
+           "rotationSpeed: %.2f)",
+           targetX, targetY, targetSpeed, rotationSpeed);
+  logger.log(buf);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file   WaypointDriving.h
+ * @brief  指定座標まで走行する合成動作
+ * @author KatLab
+ */
+
+#ifndef WAYPOINT_DRIVING_H
+#define WAYPOINT_DRIVING_H
+
+#include "CompositeMotion.h"
+#include "HeadingRotation.h"
+#include "DistanceStraight.h"
+#include "Odometry.h"
+
+class WaypointDriving : public CompositeMotion {
+ public:
+  /**
+   * コンストラクタ
+   * @param _targetX 目標座標のx座標[mm](スタート時の正面方向が正)
+   * @param _targetY 目標座標のy座標[mm](スタート時の左方向が正)
+   * @param _targetSpeed 直進の目標速度[mm/s]
+   * @param _rotationSpeed 回頭の目標速度[mm/s]
+   */
+  WaypointDriving(double _targetX, double _targetY, double _targetSpeed, double _rotationSpeed);
+
+  /**
+   * @brief 目標座標の方向に回頭し、目標座標まで直進する
+   */
+  void run() override;
+
+  /**
+   * @brief 走行する際の事前条件判定をする
+   */
+  bool isMetPrecondition();
+
+  /**
+   * @brief 実行のログを取る
+   */
+  void logRunning() override;
+
+ private:
+  static constexpr double NO_DRIVING_DISTANCE = 5.0;  // 走行を免除する距離[mm]
+  double targetX;                                     // 目標座標のx座標[mm]
+  double targetY;                                     // 目標座標のy座標[mm]
+  double targetSpeed;                                 // 直進の目標速度[mm/s]
+  double rotationSpeed;                               // 回頭の目標速度[mm/s]
+};
+
+#endif
@@ -30,8 +30,15 @@ vector<Motion*> MotionParser::createMotions(const char* commandFilePath, int tar
   char row[BUF_SIZE];           // 各行の文字を一時的に保持する領域
   const char* separator = ",";  // 区切り文字
 
+  size_t prevLineMotionCount = 0;  // 前の行を読む前の動作の数
+  LineTracing* lineTracingTarget = nullptr;  // GS・LRコマンドの設定先のライントレース動作
+
   // 行ごとにパラメータを読み込む
   while(fgets(row, BUF_SIZE, fp) != NULL) {
+    // 前の行で動作を生成したかを判定する(WD・ANコマンドの設定先を確認するため)
+    bool isPrevMotionCreated = motionList.size() > prevLineMotionCount;
+    prevLineMotionCount = motionList.size();
+
     vector<char*> params;
     // separatorを区切り文字にしてrowを分解し，paramに代入する
     char* param = strtok(row, separator);
@@ -45,23 +52,64 @@ vector<Motion*> MotionParser::createMotions(const char* commandFilePath, int tar
 
     // 取得したパラメータから動作インスタンスを生成する
     COMMAND command = convertCommand(params[0]);  // 行の最初のパラメータをCOMMAND型に変換
-    if(command == COMMAND::DL) {  // 指定距離ライントレース動作の生成
+    // GS・LRコマンドはライントレース動作の行か、それに続くGS・LRコマンドの行の次だけに書ける
+    LineTracing* prevLineTracingTarget = lineTracingTarget;
+    lineTracingTarget = nullptr;
+    if(command == COMMAND::DL || command == COMMAND::DO
+       || command == COMMAND::DN) {  // 指定距離ライントレース動作の生成
+      // PIDゲインを変換する(保存されていない名前のゲインの場合は動作を生成しない)
+      PidGain gain(0.0, 0.0, 0.0);
+      if(!convertGain(params[4], params[5], params[6], gain)) {
+        snprintf(buf, BUF_SIZE, "%s:%d: tuned gain '%s' is not found", commandFilePath, lineNum,
+                 params[4]);
+        logger.logWarning(buf);
+        lineNum++;
+        continue;
+      }
       DistanceLineTracing* dl = new DistanceLineTracing(
           atof(params[1]),                                             // 目標距離
           atof(params[2]),                                             // 目標速度
           targetBrightness + atoi(params[3]),                          // 目標輝度 + 調整
-          PidGain(atof(params[4]), atof(params[5]), atof(params[6])),  // PIDゲイン
+          gain,                                                        // PIDゲイン
           isLeftEdge);                                                 // エッジ
-
-      motionList.push_back(dl);          // 動作リストに追加
-    } else if(command == COMMAND::CL) {  // 指定色ライントレース動作の生成
+      // DOの場合は輝度から推定した横ずれをPIDの入力にする
+      if(command == COMMAND::DO) {
+        dl->setLateralOffsetInput();
+      }
+      // DNの場合はキャリブレーションで求めた変換表で線形化した輝度をPIDの入力にする
+      if(command == COMMAND::DN) {
+        dl->setLinearizedInput();
+      }
+
+      lineTracingTarget = dl;  // 続くGS・LRコマンドの設定先にする
+      motionList.push_back(dl);                                    // 動作リストに追加
+    } else if(command == COMMAND::CL || command == COMMAND::CO
+              || command == COMMAND::CN) {  // 指定色ライントレース動作の生成
+      // PIDゲインを変換する(保存されていない名前のゲインの場合は動作を生成しない)
+      PidGain gain(0.0, 0.0, 0.0);
+      if(!convertGain(params[4], params[5], params[6], gain)) {
+        snprintf(buf, BUF_SIZE, "%s:%d: tuned gain '%s' is not found", commandFilePath, lineNum,
+                 params[4]);
+        logger.logWarning(buf);
+        lineNum++;
+        continue;
+      }
       ColorLineTracing* cl = new ColorLineTracing(
           ColorJudge::stringToColor(params[1]),                        // 目標色
           atof(params[2]),                                             // 目標速度
           targetBrightness + atoi(params[3]),                          // 目標輝度 + 調整
-          PidGain(atof(params[4]), atof(params[5]), atof(params[6])),  // PIDゲイン
+          gain,                                                        // PIDゲイン
           isLeftEdge);                                                 // エッジ
-
+      // COの場合は輝度から推定した横ずれをPIDの入力にする
+      if(command == COMMAND::CO) {
+        cl->setLateralOffsetInput();
+      }
+      // CNの場合はキャリブレーションで求めた変換表で線形化した輝度をPIDの入力にする
+      if(command == COMMAND::CN) {
+        cl->setLinearizedInput();
+      }
+
+      lineTracingTarget = cl;  // 続くGS・LRコマンドの設定先にする
       motionList.push_back(cl);          // 動作リストに追加
     } else if(command == COMMAND::DS) {  // 指定距離直進動作の生成
       DistanceStraight* ds = new DistanceStraight(atof(params[1]),   // 目標距離
@@ -110,6 +158,13 @@ vector<Motion*> MotionParser::createMotions(const char* commandFilePath, int tar
       ArmMotion* am = new ArmMotion(atoi(params[1]), atoi(params[2]));
 
       motionList.push_back(am);          // 動作リストに追加
+    } else if(command == COMMAND::AP) {  // 軌道に追従させるアーム動作の追加
+      ArmMotion* ap = new ArmMotion(atoi(params[1]),   // アームを上下する角度
+                                    atoi(params[2]));  // PWM値の上限
+      ap->setProfile(atof(params[3]),   // 軌道の角速度の上限
+                     atof(params[4]));  // 軌道の角加速度の上限
+
+      motionList.push_back(ap);          // 動作リストに追加
     } else if(command == COMMAND::XR) {  // 角度補正回頭の追加
       CorrectingRotation* xr = new CorrectingRotation(atoi(params[1]),   // 目標角度
                                                       atof(params[2]));  // 目標速度
@@ -150,8 +205,131 @@ vector<Motion*> MotionParser::createMotions(const char* commandFilePath, int tar
     } else if(command == COMMAND::BT) {  // ブロック投げ入れ
       BlockThrowing* bt = new BlockThrowing();
 
-      motionList.push_back(bt);  // 動作リストに追加
-    } else {                     // 未定義のコマンドの場合
+      motionList.push_back(bt);          // 動作リストに追加
+    } else if(command == COMMAND::HR) {  // 向き指定回頭
+      HeadingRotation* hr = new HeadingRotation(atof(params[1]),   // 目標の向き
+                                                atof(params[2]));  // 目標速度
+
+      motionList.push_back(hr);          // 動作リストに追加
+    } else if(command == COMMAND::WP) {  // 座標指定走行
+      WaypointDriving* wp = new WaypointDriving(atof(params[1]),   // 目標座標のx座標
+                                                atof(params[2]),   // 目標座標のy座標
+                                                atof(params[3]),   // 直進の目標速度
+                                                atof(params[4]));  // 回頭の目標速度
+
+      motionList.push_back(wp);          // 動作リストに追加
+    } else if(command == COMMAND::DV) {  // 速度適応付き指定距離ライントレース動作の生成
+      // PIDゲインを変換する(保存されていない名前のゲインの場合は動作を生成しない)
+      PidGain gain(0.0, 0.0, 0.0);
+      if(!convertGain(params[5], params[6], params[7], gain)) {
+        snprintf(buf, BUF_SIZE, "%s:%d: tuned gain '%s' is not found", commandFilePath, lineNum,
+                 params[5]);
+        logger.logWarning(buf);
+        lineNum++;
+        continue;
+      }
+      DistanceLineTracing* dv = new DistanceLineTracing(
+          atof(params[1]),                                             // 目標距離
+          atof(params[3]),                                             // 直線での目標速度
+          targetBrightness + atoi(params[4]),                          // 目標輝度 + 調整
+          gain,                                                        // PIDゲイン
+          isLeftEdge);                                                 // エッジ
+      dv->setSpeedRange(atof(params[2]), atof(params[3]));  // カーブと直線での目標速度
+
+      lineTracingTarget = dv;  // 続くGS・LRコマンドの設定先にする
+      motionList.push_back(dv);          // 動作リストに追加
+    } else if(command == COMMAND::CV) {  // 速度適応付き指定色ライントレース動作の生成
+      // PIDゲインを変換する(保存されていない名前のゲインの場合は動作を生成しない)
+      PidGain gain(0.0, 0.0, 0.0);
+      if(!convertGain(params[5], params[6], params[7], gain)) {
+        snprintf(buf, BUF_SIZE, "%s:%d: tuned gain '%s' is not found", commandFilePath, lineNum,
+                 params[5]);
+        logger.logWarning(buf);
+        lineNum++;
+        continue;
+      }
+      ColorLineTracing* cv = new ColorLineTracing(
+          ColorJudge::stringToColor(params[1]),                        // 目標色
+          atof(params[3]),                                             // 直線での目標速度
+          targetBrightness + atoi(params[4]),                          // 目標輝度 + 調整
+          gain,                                                        // PIDゲイン
+          isLeftEdge);                                                 // エッジ
+      cv->setSpeedRange(atof(params[2]), atof(params[3]));  // カーブと直線での目標速度
+
+      lineTracingTarget = cv;  // 続くGS・LRコマンドの設定先にする
+      motionList.push_back(cv);          // 動作リストに追加
+    } else if(command == COMMAND::AT) {  // PIDゲインの自動調整
+      char* gainName = StringOperator::removeEOL(params[6]);
+      PidAutoTuning* at = new PidAutoTuning(
+          atof(params[1]),                                // 調整に使う最大距離
+          atof(params[2]),                                // 目標速度
+          targetBrightness + atoi(params[3]),             // 目標輝度 + 調整
+          atof(params[4]),                                // リレー出力とする旋回値
+          convertTuningRule(params[5]),                   // 調整則
+          strcmp(gainName, "none") == 0 ? "" : gainName,  // 保存する名前
+          isLeftEdge);                                    // エッジ
+
+      motionList.push_back(at);          // 動作リストに追加
+    } else if(command == COMMAND::BS) {  // 輝度→横ずれの変換表を作る回頭
+      BrightnessSweep* bs = new BrightnessSweep(atof(params[1]),   // 左右に回頭する角度
+                                                atoi(params[2]));  // 回頭のPWM値
+
+      motionList.push_back(bs);          // 動作リストに追加
+    } else if(command == COMMAND::OA) {  // 障害物への接近
+      ObstacleApproach* oa = new ObstacleApproach(atof(params[1]),   // 目標速度
+                                                  atoi(params[2]),   // 止まる距離
+                                                  atoi(params[3]),   // 減速を始める距離
+                                                  atof(params[4]));  // 打ち切る走行距離
+
+      motionList.push_back(oa);          // 動作リストに追加
+    } else if(command == COMMAND::FF) {  // フィードフォワードモデルの較正
+      FeedforwardCalibration* ff = new FeedforwardCalibration(atoi(params[1]),   // 最初のPWM値
+                                                              atoi(params[2]),   // 最後のPWM値
+                                                              atoi(params[3]),   // 段階の幅
+                                                              atoi(params[4]));  // 段階の時間
+
+      motionList.push_back(ff);          // 動作リストに追加
+    } else if(command == COMMAND::WD) {  // 直前の動作の制限時間・制限距離の設定
+      if(!isPrevMotionCreated) {
+        snprintf(buf, BUF_SIZE, "%s:%d: WD must follow a motion command", commandFilePath,
+                 lineNum);
+        logger.logWarning(buf);
+      } else {
+        motionList.back()->setWatchdogLimit(atoi(params[1]),                      // 制限時間
+                                            atof(params[2]),                      // 制限距離
+                                            convertWatchdogReaction(params[3]));  // 対処
+      }
+    } else if(command == COMMAND::GS) {  // 直前のライントレース動作のゲインスケジュールの設定
+      if(prevLineTracingTarget == nullptr) {
+        snprintf(buf, BUF_SIZE, "%s:%d: GS must follow a line tracing command", commandFilePath,
+                 lineNum);
+        logger.logWarning(buf);
+      } else {
+        prevLineTracingTarget->addGainScheduleLevel(
+            atof(params[1]),                                               // 平均走行速度
+            PidGain(atof(params[2]), atof(params[3]), atof(params[4])),    // 直線でのPIDゲイン
+            PidGain(atof(params[5]), atof(params[6]), atof(params[7])));  // カーブでのPIDゲイン
+        lineTracingTarget = prevLineTracingTarget;  // 続くGS・LRコマンドも同じ動作に設定する
+      }
+    } else if(command == COMMAND::LR) {  // 直前のライントレース動作のラインの探し直しの設定
+      if(prevLineTracingTarget == nullptr) {
+        snprintf(buf, BUF_SIZE, "%s:%d: LR must follow a line tracing command", commandFilePath,
+                 lineNum);
+        logger.logWarning(buf);
+      } else {
+        prevLineTracingTarget->setLineRecovery(atoi(params[1]),   // 探し直す回数の上限
+                                               atof(params[2]));  // 左右それぞれに探す角度
+        lineTracingTarget = prevLineTracingTarget;  // 続くGS・LRコマンドも同じ動作に設定する
+      }
+    } else if(command == COMMAND::AN) {  // 直前の動作の車輪の異常への対処の設定
+      if(!isPrevMotionCreated) {
+        snprintf(buf, BUF_SIZE, "%s:%d: AN must follow a motion command", commandFilePath,
+                 lineNum);
+        logger.logWarning(buf);
+      } else {
+        motionList.back()->setAnomalyReaction(convertAnomalyReaction(params[1]));  // 対処
+      }
+    } else {  // 未定義のコマンドの場合
       snprintf(buf, BUF_SIZE, "%s:%d: '%s' is undefined command", commandFilePath, lineNum,
                params[0]);
       logger.logWarning(buf);
@@ -205,6 +383,40 @@ COMMAND MotionParser::convertCommand(char* str)
     return COMMAND::ST;
   } else if(strcmp(str, "BT") == 0) {  // 文字列がBTの場合
     return COMMAND::BT;
+  } else if(strcmp(str, "HR") == 0) {  // 文字列がHRの場合
+    return COMMAND::HR;
+  } else if(strcmp(str, "WP") == 0) {  // 文字列がWPの場合
+    return COMMAND::WP;
+  } else if(strcmp(str, "DV") == 0) {  // 文字列がDVの場合
+    return COMMAND::DV;
+  } else if(strcmp(str, "CV") == 0) {  // 文字列がCVの場合
+    return COMMAND::CV;
+  } else if(strcmp(str, "AT") == 0) {  // 文字列がATの場合
+    return COMMAND::AT;
+  } else if(strcmp(str, "DO") == 0) {  // 文字列がDOの場合
+    return COMMAND::DO;
+  } else if(strcmp(str, "CO") == 0) {  // 文字列がCOの場合
+    return COMMAND::CO;
+  } else if(strcmp(str, "DN") == 0) {  // 文字列がDNの場合
+    return COMMAND::DN;
+  } else if(strcmp(str, "CN") == 0) {  // 文字列がCNの場合
+    return COMMAND::CN;
+  } else if(strcmp(str, "BS") == 0) {  // 文字列がBSの場合
+    return COMMAND::BS;
+  } else if(strcmp(str, "OA") == 0) {  // 文字列がOAの場合
+    return COMMAND::OA;
+  } else if(strcmp(str, "WD") == 0) {  // 文字列がWDの場合
+    return COMMAND::WD;
+  } else if(strcmp(str, "GS") == 0) {  // 文字列がGSの場合
+    return COMMAND::GS;
+  } else if(strcmp(str, "LR") == 0) {  // 文字列がLRの場合
+    return COMMAND::LR;
+  } else if(strcmp(str, "AP") == 0) {  // 文字列がAPの場合
+    return COMMAND::AP;
+  } else if(strcmp(str, "AN") == 0) {  // 文字列がANの場合
+    return COMMAND::AN;
+  } else if(strcmp(str, "FF") == 0) {  // 文字列がFFの場合
+    return COMMAND::FF;
   } else {  // 想定していない文字列が来た場合
     return COMMAND::NONE;
   }
@@ -271,4 +483,68 @@ CameraAction::Subject MotionParser::convertSubject(char* stringParameter)
     logger.logWarning("Parameter before conversion must be 'A' or 'B' or 'BA'");
     return CameraAction::Subject::UNDEFINED;
   }
+}
+
+TUNING_RULE MotionParser::convertTuningRule(char* stringParameter)
+{
+  Logger logger;
+
+  // 末尾の改行を削除
+  char* param = StringOperator::removeEOL(stringParameter);
+
+  if(strcmp(param, "ZN") == 0) {  // パラメータがZNの場合
+    return TUNING_RULE::ZIEGLER_NICHOLS;
+  } else if(strcmp(param, "TL") == 0) {  // パラメータがTLの場合
+    return TUNING_RULE::TYREUS_LUYBEN;
+  } else {  // 想定していないパラメータが来た場合
+    logger.logWarning("Parameter before conversion must be 'ZN' or 'TL'");
+    return TUNING_RULE::ZIEGLER_NICHOLS;
+  }
+}
+
+WATCHDOG_REACTION MotionParser::convertWatchdogReaction(char* stringParameter)
+{
+  Logger logger;
+
+  // 末尾の改行を削除
+  char* param = StringOperator::removeEOL(stringParameter);
+
+  if(strcmp(param, "continue") == 0) {  // パラメータがcontinueの場合
+    return WATCHDOG_REACTION::CONTINUE;
+  } else if(strcmp(param, "abort") == 0) {  // パラメータがabortの場合
+    return WATCHDOG_REACTION::ABORT;
+  } else {  // 想定していないパラメータが来た場合
+    logger.logWarning("Parameter before conversion must be 'continue' or 'abort'");
+    return WATCHDOG_REACTION::CONTINUE;
+  }
+}
+
+ANOMALY_REACTION MotionParser::convertAnomalyReaction(char* stringParameter)
+{
+  Logger logger;
+
+  // 末尾の改行を削除
+  char* param = StringOperator::removeEOL(stringParameter);
+
+  if(strcmp(param, "continue") == 0) {  // パラメータがcontinueの場合
+    return ANOMALY_REACTION::CONTINUE;
+  } else if(strcmp(param, "abort") == 0) {  // パラメータがabortの場合
+    return ANOMALY_REACTION::ABORT;
+  } else if(strcmp(param, "retry") == 0) {  // パラメータがretryの場合
+    return ANOMALY_REACTION::RETRY;
+  } else {  // 想定していないパラメータが来た場合
+    logger.logWarning("Parameter before conversion must be 'continue', 'abort' or 'retry'");
+    return ANOMALY_REACTION::CONTINUE;
+  }
+}
+
+bool MotionParser::convertGain(char* kp, char* ki, char* kd, PidGain& gain)
+{
+  // "@名前"の場合は自動調整で保存されたゲインを使う
+  if(kp[0] == '@') {
+    return PidGainStore::findGain(kp + 1, gain);
+  }
+
+  gain = PidGain(atof(kp), atof(ki), atof(kd));
+  return true;
 }
\ No newline at end of file
@@ -32,6 +32,13 @@
 #include "Stop.h"
 #include "ArmMotion.h"
 #include "BlockThrowing.h"
+#include "HeadingRotation.h"
+#include "WaypointDriving.h"
+#include "PidAutoTuning.h"
+#include "PidGainStore.h"
+#include "BrightnessSweep.h"
+#include "ObstacleApproach.h"
+#include "FeedforwardCalibration.h"
 
 enum class COMMAND {
   DL,  // 指定距離ライントレース
@@ -54,6 +61,23 @@ enum class COMMAND {
   PR,  // Pwm値指定回頭
   ST,  // 左右モーターストップ
   BT,
+  HR,  // 向き指定回頭
+  WP,  // 座標指定走行
+  DV,  // 速度適応付き指定距離ライントレース
+  CV,  // 速度適応付き指定色ライントレース
+  AT,  // PIDゲインの自動調整
+  DO,  // 横ずれ入力の指定距離ライントレース
+  CO,  // 横ずれ入力の指定色ライントレース
+  DN,  // 線形化した輝度入力の指定距離ライントレース
+  CN,  // 線形化した輝度入力の指定色ライントレース
+  BS,  // 輝度→横ずれの変換表を作る回頭
+  OA,  // 障害物への接近
+  WD,  // 直前の動作の制限時間・制限距離
+  AN,  // 直前の動作の車輪の異常への対処
+  GS,  // 直前のライントレース動作のゲインスケジュール
+  LR,  // 直前のライントレース動作のラインの探し直し
+  AP,  // 軌道に追従させるアーム動作
+  FF,  // フィードフォワードモデルの較正
   NONE
 };
 
@@ -93,6 +117,37 @@ class MotionParser {
    * @return Subject値
    */
   static CameraAction::Subject convertSubject(char* stringParameter);
+
+  /**
+   * @brief 文字列をTUNING_RULE型に変換する
+   * @param stringParameter 文字列のパラメータ("ZN" または "TL")
+   * @return 調整則
+   */
+  static TUNING_RULE convertTuningRule(char* stringParameter);
+
+  /**
+   * @brief 文字列をWATCHDOG_REACTION型に変換する
+   * @param stringParameter 文字列のパラメータ("continue" または "abort")
+   * @return 制限を超えたときの動作リストの対処
+   */
+  static WATCHDOG_REACTION convertWatchdogReaction(char* stringParameter);
+
+  /**
+   * @brief 文字列をANOMALY_REACTION型に変換する
+   * @param stringParameter 文字列のパラメータ("continue", "abort" または "retry")
+   * @return 車輪の異常を検知したときの動作の対処
+   */
+  static ANOMALY_REACTION convertAnomalyReaction(char* stringParameter);
+
+  /**
+   * @brief PIDゲインの列を変換する
+   * @param kp Pゲインの列("@名前"の場合はPidGainStoreに保存された同じ名前のゲインを使う)
+   * @param ki Iゲインの列
+   * @param kd Dゲインの列
+   * @param gain 変換したPIDゲインを格納する変数
+   * @return true:変換できた, false:名前のゲインが保存されていない
+   */
+  static bool convertGain(char* kp, char* ki, char* kd, PidGain& gain);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * @file BackgroundJob.cpp
+ * @brief シェルコマンドを子プロセスで並行に実行するクラス
+ * @author KatLab
+ */
+
+#include "BackgroundJob.h"
+
+BackgroundJob::BackgroundJob(const char* _name, const char* _command)
+  : name(_name), command(_command), pid(-1), exitStatus(-1), startTime(0), duration(0)
+{
+}
+
+bool BackgroundJob::start()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  startTime = timer.nowMicro();
+  pid = fork();
+  if(pid == 0) {
+    // 子プロセスではコマンドを実行して終了する(親のバッファを二重に出力しないよう_exitで終わる)
+    execl("/bin/sh", "sh", "-c", command, (char*)NULL);
+    _exit(127);
+  }
+  if(pid < 0) {
+    snprintf(buf, BUF_SIZE, "Background job '%s' could not be started", name);
+    logger.logWarning(buf);
+    return false;
+  }
+  return true;
+}
+
+int BackgroundJob::join()
+{
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  // 開始していない、または完了を確認済みの場合は待たない
+  if(pid < 0) return exitStatus;
+
+  uint64_t joinTime = timer.nowMicro();
+  int status = 0;
+  exitStatus = waitpid(pid, &status, 0) == pid && WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  pid = -1;
+  uint64_t endTime = timer.nowMicro();
+  duration = endTime - startTime;
+
+  snprintf(buf, BUF_SIZE,
+           "Background job '%s' finished (status: %d, duration: %.1fms, waited: %.1fms)", name,
+           exitStatus, duration / 1000.0, (endTime - joinTime) / 1000.0);
+  if(exitStatus == 0) {
+    logger.log(buf);
+  } else {
+    logger.logWarning(buf);
+  }
+  return exitStatus;
+}
+
+uint64_t BackgroundJob::getDuration()
+{
+  return duration;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file BackgroundJob.h
+ * @brief シェルコマンドを子プロセスで並行に実行するクラス
+ * @author KatLab
+ */
+
+#ifndef BACKGROUND_JOB_H
+#define BACKGROUND_JOB_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "Timer.h"
+#include "Logger.h"
+
+class BackgroundJob {
+ public:
+  /**
+   * コンストラクタ
+   * @param _name ログに出すジョブの名前
+   * @param _command 実行するシェルコマンド
+   * @note 引数の文字列はstart()を呼び出すまで保持しておくこと
+   */
+  BackgroundJob(const char* _name, const char* _command);
+
+  /**
+   * @brief 子プロセスでコマンドの実行を開始し、完了を待たずに戻る
+   * @return true:開始できた, false:子プロセスを生成できない
+   */
+  bool start();
+
+  /**
+   * @brief コマンドの完了を待つ(合流点)
+   * @return コマンドの終了ステータス(開始できなかった場合や異常終了した場合は-1)
+   * @note 所要時間と合流点で待った時間をログに出す
+   */
+  int join();
+
+  /**
+   * @brief 開始から完了までの時間を取得する
+   * @return 所要時間[us](完了前は0)
+   * @note 完了時刻はjoin()で完了を確認した時刻とする
+   */
+  uint64_t getDuration();
+
+ private:
+  const char* name;     // ジョブの名前
+  const char* command;  // 実行するシェルコマンド
+  pid_t pid;            // 子プロセスのID(開始前・完了後は-1)
+  int exitStatus;       // コマンドの終了ステータス
+  uint64_t startTime;   // 開始時刻[us]
+  uint64_t duration;    // 所要時間[us]
+  Timer timer;
+};
+
+#endif
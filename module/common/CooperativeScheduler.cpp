@@ -0,0 +1,117 @@
+/**
+ * @file CooperativeScheduler.cpp
+ * @brief 再開可能なタスクを制御周期ごとに協調的に進めるスケジューラ
+ * @author KatLab
+ */
+
+#include "CooperativeScheduler.h"
+
+CooperativeTask* CooperativeScheduler::tasks[CooperativeScheduler::MAX_TASK_COUNT] = {};
+int CooperativeScheduler::taskCount = 0;
+bool CooperativeScheduler::isTicking = false;
+
+bool CooperativeScheduler::add(CooperativeTask* task)
+{
+  if(task == nullptr || isScheduled(task) || taskCount >= MAX_TASK_COUNT) return false;
+  tasks[taskCount] = task;
+  taskCount++;
+  return true;
+}
+
+void CooperativeScheduler::remove(CooperativeTask* task)
+{
+  for(int i = 0; i < taskCount; i++) {
+    if(tasks[i] == task) {
+      // 登録順を保ったまま詰める
+      for(int j = i; j < taskCount - 1; j++) {
+        tasks[j] = tasks[j + 1];
+      }
+      taskCount--;
+      tasks[taskCount] = nullptr;
+      return;
+    }
+  }
+}
+
+bool CooperativeScheduler::isScheduled(CooperativeTask* task)
+{
+  for(int i = 0; i < taskCount; i++) {
+    if(tasks[i] == task) return true;
+  }
+  return false;
+}
+
+void CooperativeScheduler::tick()
+{
+  // タスクの中で制御ループが回っても、同じタスクを二重に進めない
+  if(isTicking) return;
+  isTicking = true;
+
+  // 登録順に1ティック分ずつ進め、終わったタスクを詰めて外す
+  int nextCount = 0;
+  for(int i = 0; i < taskCount; i++) {
+    if(tasks[i]->resume()) {
+      tasks[nextCount] = tasks[i];
+      nextCount++;
+    }
+  }
+  for(int i = nextCount; i < taskCount; i++) {
+    tasks[i] = nullptr;
+  }
+  taskCount = nextCount;
+
+  isTicking = false;
+}
+
+void CooperativeScheduler::runUntilFinished(CooperativeTask* task)
+{
+  Timer timer;
+  uint64_t nextTime = timer.nowMicro();
+
+  while(isScheduled(task)) {
+    // 制御周期の開始を記録する
+    LoopProfiler::beginCycle();
+
+    tick();
+    if(!isScheduled(task)) break;
+
+    // 制御周期の計算時間を計測する
+    LoopProfiler::endCycle();
+
+    // 計算時間によらず一定の周期で進める
+    nextTime += TICK_PERIOD * 1000;
+    timer.sleepUntil(nextTime);
+  }
+
+  // 制御ループの終了を記録する
+  LoopProfiler::endLoop();
+}
+
+void CooperativeScheduler::sleep(int milliSec)
+{
+  Timer timer;
+  if(taskCount == 0) {
+    timer.sleep(milliSec);
+    return;
+  }
+
+  uint64_t endTime = timer.nowMicro() + static_cast<uint64_t>(milliSec) * 1000;
+  while(timer.nowMicro() < endTime) {
+    tick();
+    uint64_t nextTime = timer.nowMicro() + TICK_PERIOD * 1000;
+    timer.sleepUntil(nextTime < endTime ? nextTime : endTime);
+  }
+}
+
+int CooperativeScheduler::getTaskCount()
+{
+  return taskCount;
+}
+
+void CooperativeScheduler::clear()
+{
+  for(int i = 0; i < taskCount; i++) {
+    tasks[i] = nullptr;
+  }
+  taskCount = 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file CooperativeScheduler.h
+ * @brief 再開可能なタスクを制御周期ごとに協調的に進めるスケジューラ
+ * @author KatLab
+ */
+
+#ifndef COOPERATIVE_SCHEDULER_H
+#define COOPERATIVE_SCHEDULER_H
+
+#include <stdint.h>
+#include "Timer.h"
+#include "LoopProfiler.h"
+
+/**
+ * @brief スケジューラから1ティックずつ進められるタスクのインタフェース
+ * @note resume()は1ティック分の処理だけを行い、待たずに戻ること
+ */
+class CooperativeTask {
+ public:
+  virtual ~CooperativeTask() {}
+
+  /**
+   * @brief タスクを1ティック分だけ進める
+   * @return true:タスクを続ける, false:タスクが終わった
+   */
+  virtual bool resume() = 0;
+};
+
+class CooperativeScheduler {
+ public:
+  CooperativeScheduler() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief タスクを登録する
+   * @param task 登録するタスク(終わるまで実体を保持しておくこと)
+   * @return true:登録した, false:既に登録されている、または登録数の上限に達している
+   */
+  static bool add(CooperativeTask* task);
+
+  /**
+   * @brief タスクの登録を解除する
+   * @param task 解除するタスク(登録されていない場合は何もしない)
+   */
+  static void remove(CooperativeTask* task);
+
+  /**
+   * @brief タスクが登録されているかを判定する
+   * @param task 判定するタスク
+   * @return true:登録されている(終わっていない), false:登録されていない
+   */
+  static bool isScheduled(CooperativeTask* task);
+
+  /**
+   * @brief 登録されているタスクを登録順に1ティック分だけ進め、終わったタスクを外す
+   * @note 制御ループの各周期で呼び出す。タスクの中から呼び出された場合は何もしない
+   */
+  static void tick();
+
+  /**
+   * @brief 指定したタスクが終わるまで、TICK_PERIODごとにtick()を呼び出す
+   * @param task 終わるのを待つタスク
+   */
+  static void runUntilFinished(CooperativeTask* task);
+
+  /**
+   * @brief TICK_PERIODごとにtick()を呼び出しながら自タスクスリープする
+   * @param milliSec スリープ時間[ms]
+   * @note タスクが登録されていない場合は一度にスリープする
+   */
+  static void sleep(int milliSec);
+
+  /**
+   * @brief 登録されているタスクの数を取得する
+   * @return タスクの数
+   */
+  static int getTaskCount();
+
+  /**
+   * @brief すべてのタスクの登録を解除する
+   */
+  static void clear();
+
+  static constexpr int MAX_TASK_COUNT = 8;  // 登録できるタスクの上限
+  static constexpr int TICK_PERIOD = 10;    // ティックの周期[ms]
+
+ private:
+  static CooperativeTask* tasks[MAX_TASK_COUNT];  // 登録されているタスク(登録順)
+  static int taskCount;                           // 登録されているタスクの数
+  static bool isTicking;                          // true:tick()の実行中
+};
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file LoopProfiler.cpp
+ * @brief 動作の制御ループの周期と計算時間を計測するクラス
+ * @author KatLab
+ */
+
+#include "LoopProfiler.h"
+
+int LoopProfiler::histogram[LoopProfiler::HISTOGRAM_BIN_COUNT] = {};
+bool LoopProfiler::isInLoop = false;
+uint64_t LoopProfiler::cycleStartTime = 0;
+int LoopProfiler::cycleCount = 0;
+int LoopProfiler::computeCount = 0;
+int LoopProfiler::periodCount = 0;
+uint64_t LoopProfiler::minPeriod = 0;
+uint64_t LoopProfiler::maxPeriod = 0;
+uint64_t LoopProfiler::sumPeriod = 0;
+uint64_t LoopProfiler::maxComputeTime = 0;
+uint64_t LoopProfiler::sumComputeTime = 0;
+int LoopProfiler::overrunCount = 0;
+
+void LoopProfiler::reset()
+{
+  for(int i = 0; i < HISTOGRAM_BIN_COUNT; i++) {
+    histogram[i] = 0;
+  }
+  isInLoop = false;
+  cycleStartTime = 0;
+  cycleCount = 0;
+  computeCount = 0;
+  periodCount = 0;
+  minPeriod = 0;
+  maxPeriod = 0;
+  sumPeriod = 0;
+  maxComputeTime = 0;
+  sumComputeTime = 0;
+  overrunCount = 0;
+}
+
+void LoopProfiler::beginCycle()
+{
+  Timer timer;
+  uint64_t currentTime = timer.nowMicro();
+
+  // 同じ制御ループ内の前回の制御周期からの経過時間を周期とする
+  if(isInLoop) {
+    uint64_t period = currentTime - cycleStartTime;
+    if(periodCount == 0 || period < minPeriod) minPeriod = period;
+    if(period > maxPeriod) maxPeriod = period;
+    sumPeriod += period;
+    periodCount++;
+    if(period > DEADLINE) overrunCount++;
+
+    // 階級幅を超える周期は最後の階級に入れる
+    uint64_t bin = period / HISTOGRAM_BIN_WIDTH;
+    if(bin >= static_cast<uint64_t>(HISTOGRAM_BIN_COUNT)) bin = HISTOGRAM_BIN_COUNT - 1;
+    histogram[bin]++;
+  }
+
+  isInLoop = true;
+  cycleStartTime = currentTime;
+  cycleCount++;
+}
+
+void LoopProfiler::endCycle()
+{
+  if(!isInLoop) return;
+
+  Timer timer;
+  uint64_t computeTime = timer.elapsedMicro(cycleStartTime);
+  if(computeTime > maxComputeTime) maxComputeTime = computeTime;
+  sumComputeTime += computeTime;
+  computeCount++;
+}
+
+void LoopProfiler::endLoop()
+{
+  isInLoop = false;
+}
+
+void LoopProfiler::logSummary()
+{
+  if(cycleCount == 0) return;
+
+  const int BUF_SIZE = 256;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  snprintf(buf, BUF_SIZE,
+           "Loop (cycles: %d, period[us] min/mean/max/p99: %llu/%.1f/%llu/%llu, compute[us] "
+           "mean/max: %.1f/%llu, overruns: %d)",
+           cycleCount, (unsigned long long)getMinPeriod(), getMeanPeriod(),
+           (unsigned long long)getMaxPeriod(), (unsigned long long)getP99Period(),
+           getMeanComputeTime(), (unsigned long long)getMaxComputeTime(), overrunCount);
+  logger.log(buf);
+}
+
+int LoopProfiler::getCycleCount()
+{
+  return cycleCount;
+}
+
+int LoopProfiler::getPeriodCount()
+{
+  return periodCount;
+}
+
+uint64_t LoopProfiler::getMinPeriod()
+{
+  return minPeriod;
+}
+
+double LoopProfiler::getMeanPeriod()
+{
+  if(periodCount == 0) return 0.0;
+  return static_cast<double>(sumPeriod) / periodCount;
+}
+
+uint64_t LoopProfiler::getMaxPeriod()
+{
+  return maxPeriod;
+}
+
+uint64_t LoopProfiler::getP99Period()
+{
+  if(periodCount == 0) return 0;
+
+  // 累積度数が99%に達する階級の上端を99パーセンタイル値とする
+  int threshold = (periodCount * 99 + 99) / 100;
+  int cumulativeCount = 0;
+  for(int i = 0; i < HISTOGRAM_BIN_COUNT; i++) {
+    cumulativeCount += histogram[i];
+    if(cumulativeCount >= threshold) {
+      uint64_t upperBound = (i + 1) * HISTOGRAM_BIN_WIDTH;
+      // 階級の上端が最大値を超える場合は最大値を返す
+      return upperBound < maxPeriod ? upperBound : maxPeriod;
+    }
+  }
+  return maxPeriod;
+}
+
+double LoopProfiler::getMeanComputeTime()
+{
+  if(computeCount == 0) return 0.0;
+  return static_cast<double>(sumComputeTime) / computeCount;
+}
+
+uint64_t LoopProfiler::getMaxComputeTime()
+{
+  return maxComputeTime;
+}
+
+int LoopProfiler::getOverrunCount()
+{
+  return overrunCount;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file LoopProfiler.h
+ * @brief 動作の制御ループの周期と計算時間を計測するクラス
+ * @author KatLab
+ */
+
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "Timer.h"
+#include "Logger.h"
+
+class LoopProfiler {
+ public:
+  LoopProfiler() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 計測結果を破棄する
+   * @note 動作ごとに呼び出す
+   */
+  static void reset();
+
+  /**
+   * @brief 制御周期の開始時刻を記録する
+   * @note 制御ループの先頭で呼び出す
+   */
+  static void beginCycle();
+
+  /**
+   * @brief 制御周期の計算の終了時刻を記録する
+   * @note 制御ループの末尾（スリープ直前）で呼び出す
+   */
+  static void endCycle();
+
+  /**
+   * @brief 制御ループの終了を記録する
+   * @note 次の制御ループとの間の時間を周期に含めないよう、ループを抜けた直後に呼び出す
+   */
+  static void endLoop();
+
+  /**
+   * @brief 計測結果をログに出力する
+   * @note 制御周期を1度も計測していない場合は何も出力しない
+   */
+  static void logSummary();
+
+  /**
+   * @brief 計測した制御周期の数を取得する
+   * @return 制御周期の数
+   */
+  static int getCycleCount();
+
+  /**
+   * @brief 計測した周期の数を取得する
+   * @return 周期の数(制御ループごとに制御周期の数より1少ない)
+   */
+  static int getPeriodCount();
+
+  /**
+   * @brief 周期の最小値を取得する
+   * @return 周期の最小値[us]
+   */
+  static uint64_t getMinPeriod();
+
+  /**
+   * @brief 周期の平均値を取得する
+   * @return 周期の平均値[us]
+   */
+  static double getMeanPeriod();
+
+  /**
+   * @brief 周期の最大値を取得する
+   * @return 周期の最大値[us]
+   */
+  static uint64_t getMaxPeriod();
+
+  /**
+   * @brief 周期の99パーセンタイル値を取得する
+   * @return 周期の99パーセンタイル値[us](HISTOGRAM_BIN_WIDTH単位に切り上げた値)
+   */
+  static uint64_t getP99Period();
+
+  /**
+   * @brief 計算時間の平均値を取得する
+   * @return 計算時間の平均値[us]
+   */
+  static double getMeanComputeTime();
+
+  /**
+   * @brief 計算時間の最大値を取得する
+   * @return 計算時間の最大値[us]
+   */
+  static uint64_t getMaxComputeTime();
+
+  /**
+   * @brief 周期がデッドラインを超えた回数を取得する
+   * @return デッドラインを超えた回数
+   */
+  static int getOverrunCount();
+
+  static constexpr uint64_t DEADLINE = 15000;  // 周期のデッドライン[us](目標周期10msの1.5倍)
+  static constexpr uint64_t HISTOGRAM_BIN_WIDTH = 200;  // ヒストグラムの階級幅[us]
+
+ private:
+  static constexpr int HISTOGRAM_BIN_COUNT = 256;  // ヒストグラムの階級数(51.2msまで)
+  static int histogram[HISTOGRAM_BIN_COUNT];       // 周期のヒストグラム
+  static bool isInLoop;            // true:制御ループの途中, false:制御ループの外
+  static uint64_t cycleStartTime;  // 実行中の制御周期の開始時刻[us]
+  static int cycleCount;
+  static int computeCount;
+  static int periodCount;
+  static uint64_t minPeriod;
+  static uint64_t maxPeriod;
+  static uint64_t sumPeriod;
+  static uint64_t maxComputeTime;
+  static uint64_t sumComputeTime;
+  static int overrunCount;
+};
+
+#endif
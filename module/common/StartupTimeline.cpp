@@ -0,0 +1,67 @@
+/**
+ * @file StartupTimeline.cpp
+ * @brief 起動から走行開始までの各段階の所要時間を記録するクラス
+ * @author KatLab
+ */
+
+#include "StartupTimeline.h"
+
+const char* StartupTimeline::stepNames[StartupTimeline::MAX_STEP_COUNT] = {};
+uint64_t StartupTimeline::stepDurations[StartupTimeline::MAX_STEP_COUNT] = {};
+int StartupTimeline::stepCount = 0;
+uint64_t StartupTimeline::beginTime = 0;
+uint64_t StartupTimeline::lastMarkTime = 0;
+
+void StartupTimeline::begin()
+{
+  Timer timer;
+  stepCount = 0;
+  beginTime = timer.nowMicro();
+  lastMarkTime = beginTime;
+}
+
+void StartupTimeline::mark(const char* stepName)
+{
+  Timer timer;
+  uint64_t currentTime = timer.nowMicro();
+  if(stepCount < MAX_STEP_COUNT) {
+    stepNames[stepCount] = stepName;
+    stepDurations[stepCount] = currentTime - lastMarkTime;
+    stepCount++;
+  }
+  lastMarkTime = currentTime;
+}
+
+void StartupTimeline::logSummary()
+{
+  const int BUF_SIZE = 128;
+  char buf[BUF_SIZE];  // log用にメッセージを一時保持する領域
+  Logger logger;
+
+  logger.log("Startup timeline:");
+  uint64_t elapsed = 0;
+  for(int i = 0; i < stepCount; i++) {
+    elapsed += stepDurations[i];
+    snprintf(buf, BUF_SIZE, "  %-24s %8.1fms (at %8.1fms)", stepNames[i],
+             stepDurations[i] / 1000.0, elapsed / 1000.0);
+    logger.log(buf);
+  }
+  snprintf(buf, BUF_SIZE, "  %-24s %8.1fms", "total", getTotalDuration() / 1000.0);
+  logger.log(buf);
+}
+
+int StartupTimeline::getStepCount()
+{
+  return stepCount;
+}
+
+uint64_t StartupTimeline::getStepDuration(int index)
+{
+  if(index < 0 || index >= stepCount) return 0;
+  return stepDurations[index];
+}
+
+uint64_t StartupTimeline::getTotalDuration()
+{
+  return lastMarkTime - beginTime;
+}
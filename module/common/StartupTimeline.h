@@ -0,0 +1,65 @@
+/**
+ * @file StartupTimeline.h
+ * @brief 起動から走行開始までの各段階の所要時間を記録するクラス
+ * @author KatLab
+ */
+
+#ifndef STARTUP_TIMELINE_H
+#define STARTUP_TIMELINE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "Timer.h"
+#include "Logger.h"
+
+class StartupTimeline {
+ public:
+  StartupTimeline() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 記録を破棄し、起動時刻を記録する
+   */
+  static void begin();
+
+  /**
+   * @brief 前の段階の終了(最初はbegin())からの所要時間を記録する
+   * @param stepName 終わった段階の名前(文字列は記録を出力するまで保持しておくこと)
+   * @note MAX_STEP_COUNTを超えた段階は記録しない
+   */
+  static void mark(const char* stepName);
+
+  /**
+   * @brief 各段階の所要時間と合計をログに出力する
+   */
+  static void logSummary();
+
+  /**
+   * @brief 記録した段階の数を取得する
+   * @return 段階の数
+   */
+  static int getStepCount();
+
+  /**
+   * @brief 段階の所要時間を取得する
+   * @param index 段階の番号(記録した順に0から)
+   * @return 所要時間[us](範囲外の場合は0)
+   */
+  static uint64_t getStepDuration(int index);
+
+  /**
+   * @brief 起動からの合計時間を取得する
+   * @return 最後に記録した段階までの合計時間[us]
+   */
+  static uint64_t getTotalDuration();
+
+  static constexpr int MAX_STEP_COUNT = 16;  // 記録する段階の上限
+
+ private:
+  static const char* stepNames[MAX_STEP_COUNT];   // 段階の名前
+  static uint64_t stepDurations[MAX_STEP_COUNT];  // 段階の所要時間[us]
+  static int stepCount;                           // 記録した段階の数
+  static uint64_t beginTime;                      // 起動時刻[us]
+  static uint64_t lastMarkTime;                   // 前の段階の終了時刻[us]
+};
+
+#endif
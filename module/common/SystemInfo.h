@@ -13,6 +13,7 @@ static constexpr int WHITE_BRIGHTNESS = 93;  // 白の輝度
 
 static constexpr double RADIUS = 50.0;  // 車輪の半径[mm]
 static constexpr double TREAD = 125.0;  // 走行体のトレッド幅（両輪の間の距離）[mm]
+static constexpr double COLOR_SENSOR_DISTANCE = 80.0;  // 車軸の中心からカラーセンサまでの距離[mm]
 
 static constexpr char RAS_PI_IP[16] = "172.20.1.1";
 
@@ -0,0 +1,77 @@
+/**
+ * @file TelemetryRecorder.cpp
+ * @brief 走行中のセンサ値と指令PWM値を記録するクラス
+ * @author KatLab
+ */
+
+#include "TelemetryRecorder.h"
+
+TelemetrySample TelemetryRecorder::samples[TelemetryRecorder::MAX_SAMPLE_COUNT];
+int TelemetryRecorder::sampleCount = 0;
+bool TelemetryRecorder::isEnabled = false;
+
+void TelemetryRecorder::setEnabled(bool _isEnabled)
+{
+  isEnabled = _isEnabled;
+}
+
+bool TelemetryRecorder::getIsEnabled()
+{
+  return isEnabled;
+}
+
+void TelemetryRecorder::record(bool isFinal)
+{
+  // 記録が無効、または記録領域が埋まっている場合は何もしない
+  if(!isEnabled || sampleCount >= MAX_SAMPLE_COUNT) return;
+
+  // センサへの再問い合わせを避けるため、周期中に取得した値を記録する
+  Timer timer;
+  TelemetrySample& sample = samples[sampleCount];
+  sample.time = timer.nowMicro();
+  sample.rgb = Measurer::getLastRawColor();
+  sample.rightCount = Measurer::getLastRightCount();
+  sample.leftCount = Measurer::getLastLeftCount();
+  sample.rightTotalCount = Measurer::getLastRightTotalCount();
+  sample.leftTotalCount = Measurer::getLastLeftTotalCount();
+  sample.rightPwm = Controller::getRightPwm();
+  sample.leftPwm = Controller::getLeftPwm();
+  sample.isFinal = isFinal;
+  sampleCount++;
+}
+
+void TelemetryRecorder::outputToFile(const char* filePath)
+{
+  Logger logger;
+
+  // 記録がない場合はファイルを生成しない
+  if(sampleCount == 0) return;
+
+  FILE* outputFile = fopen(filePath, "w");
+  if(outputFile == NULL) {
+    logger.logWarning("cannot open telemetry file");
+    return;
+  }
+
+  fprintf(outputFile,
+          "time,r,g,b,rightCount,leftCount,rightTotalCount,leftTotalCount,rightPwm,leftPwm,"
+          "isFinal\n");
+  for(int i = 0; i < sampleCount; i++) {
+    const TelemetrySample& sample = samples[i];
+    fprintf(outputFile, "%llu,%d,%d,%d,%d,%d,%d,%d,%.17g,%.17g,%d\n",
+            (unsigned long long)sample.time, sample.rgb.r, sample.rgb.g, sample.rgb.b,
+            sample.rightCount, sample.leftCount, sample.rightTotalCount, sample.leftTotalCount,
+            sample.rightPwm, sample.leftPwm, sample.isFinal ? 1 : 0);
+  }
+  fclose(outputFile);
+}
+
+void TelemetryRecorder::clear()
+{
+  sampleCount = 0;
+}
+
+int TelemetryRecorder::getSampleCount()
+{
+  return sampleCount;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file TelemetryRecorder.h
+ * @brief 走行中のセンサ値と指令PWM値を記録するクラス
+ * @author KatLab
+ */
+
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "Measurer.h"
+#include "Controller.h"
+#include "Timer.h"
+#include "Logger.h"
+
+// 1周期分の走行記録
+struct TelemetrySample {
+  uint64_t time;        // 記録時刻[us]
+  rgb_raw_t rgb;        // 周期中に取得したRGB値
+  int rightCount;       // 周期中に取得した右モータ角位置[deg]
+  int leftCount;        // 周期中に取得した左モータ角位置[deg]
+  int rightTotalCount;  // 周期中に取得した起動時からの右モータ角位置[deg]
+  int leftTotalCount;   // 周期中に取得した起動時からの左モータ角位置[deg]
+  double rightPwm;      // 周期中に指令した右モータPWM値
+  double leftPwm;       // 周期中に指令した左モータPWM値
+  bool isFinal;         // 動作の終了判定時の記録かどうか
+};
+
+class TelemetryRecorder {
+ public:
+  TelemetryRecorder() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 記録の有効/無効を切り替える
+   * @param _isEnabled true:記録する, false:記録しない
+   */
+  static void setEnabled(bool _isEnabled);
+
+  /**
+   * @brief 記録が有効かどうかを取得する
+   * @return true:記録する, false:記録しない
+   */
+  static bool getIsEnabled();
+
+  /**
+   * @brief 1周期分のセンサ値と指令PWM値を記録する
+   * @param isFinal true:動作の終了判定時の記録, false:制御周期の記録
+   * @note 各動作の制御周期の末尾（スリープ直前）と、ループを抜けた直後（モータ停止前）で呼び出す
+   */
+  static void record(bool isFinal = false);
+
+  /**
+   * @brief 記録した走行データをCSVファイルに出力する
+   * @param filePath 出力先のファイルパス
+   */
+  static void outputToFile(const char* filePath = "telemetry.csv");
+
+  /**
+   * @brief 記録した走行データを破棄する
+   */
+  static void clear();
+
+  /**
+   * @brief 記録したサンプル数を取得する
+   * @return 記録したサンプル数
+   */
+  static int getSampleCount();
+
+ private:
+  static constexpr int MAX_SAMPLE_COUNT = 30000;  // 最大記録数(10ms周期で5分間)
+  static TelemetrySample samples[MAX_SAMPLE_COUNT];
+  static int sampleCount;  // 記録したサンプル数
+  static bool isEnabled;   // true:記録する, false:記録しない
+};
+
+#endif
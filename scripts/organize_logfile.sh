@@ -9,4 +9,10 @@ mkdir -p etrobocon2023/logfiles
 oldName="logfile.txt"
 newName=`date +"%m%d-%H:%M.txt"`
 
-mv -f $oldName etrobocon2023/logfiles/$newName
\ No newline at end of file
+mv -f $oldName etrobocon2023/logfiles/$newName
+
+# 走行データファイルがあれば、ログファイルと同じ名前で退避する
+telemetryName="telemetry.csv"
+if [ -f $telemetryName ]; then
+    mv -f $telemetryName etrobocon2023/logfiles/${newName%.txt}.csv
+fi
\ No newline at end of file
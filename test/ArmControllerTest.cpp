@@ -0,0 +1,79 @@
+/**
+ * @file   ArmControllerTest.cpp
+ * @brief  ArmControllerクラスのテスト
+ * @author KatLab
+ */
+
+#include "ArmController.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // PWM値に比例した角速度で回るアームを模擬して目標角位置まで動かす
+  static int simulateArm(ArmController& controller, int initialCount, int targetCount,
+                         double& maxCount, double& minCount, double& maxSetpointSpeed)
+  {
+    const double delta = 0.01;
+    const double degPerPwm = 0.05;  // 1周期・PWM値1あたりの角位置の変化[deg]
+    double count = initialCount;
+    double prevSetpoint = initialCount;
+    maxCount = count;
+    minCount = count;
+    maxSetpointSpeed = 0.0;
+    controller.start(initialCount, targetCount);
+    for(int i = 0; i < 500; i++) {
+      double pwm = controller.update(static_cast<int>(round(count)), delta);
+      if(controller.isSettled()) return i;
+      count += pwm * degPerPwm;
+      maxCount = max(maxCount, count);
+      minCount = min(minCount, count);
+      maxSetpointSpeed
+          = max(maxSetpointSpeed, fabs(controller.getSetpoint() - prevSetpoint) / delta);
+      prevSetpoint = controller.getSetpoint();
+    }
+    return -1;
+  }
+
+  TEST(ArmControllerTest, moveAndSettle)
+  {
+    ArmController controller(40.0);
+    double maxCount, minCount, maxSetpointSpeed;
+
+    int cycleCount = simulateArm(controller, 0, -60, maxCount, minCount, maxSetpointSpeed);
+
+    // 静定し、目標を大きく行き過ぎない
+    ASSERT_LT(0, cycleCount);
+    EXPECT_DOUBLE_EQ(-60.0, controller.getSetpoint());
+    EXPECT_LE(-60.0 - ArmController::SETTLE_TOLERANCE, minCount);
+    EXPECT_GE(0.0, maxCount);
+    // 軌道の角速度は上限を超えない
+    EXPECT_GE(ArmController::MAX_SPEED + 1e-6, maxSetpointSpeed);
+  }
+
+  TEST(ArmControllerTest, moveUp)
+  {
+    ArmController controller(40.0, 100.0, 400.0);
+    double maxCount, minCount, maxSetpointSpeed;
+
+    int cycleCount = simulateArm(controller, 10, 70, maxCount, minCount, maxSetpointSpeed);
+
+    ASSERT_LT(0, cycleCount);
+    EXPECT_GE(70.0 + ArmController::SETTLE_TOLERANCE, maxCount);
+    EXPECT_GE(100.0 + 1e-6, maxSetpointSpeed);
+    // 加減速を制限するので、最高角速度で動いた場合(0.6秒)より時間がかかる
+    EXPECT_LT(60, cycleCount);
+  }
+
+  TEST(ArmControllerTest, limitPwm)
+  {
+    ArmController controller(20.0);
+    controller.start(0, 60);
+    // 角位置が動かなくてもPWM値は上限を超えない
+    for(int i = 0; i < 100; i++) {
+      double pwm = controller.update(0, 0.01);
+      EXPECT_GE(20.0, fabs(pwm));
+    }
+    EXPECT_FALSE(controller.isSettled());
+  }
+}  // namespace etrobocon2023_test
@@ -187,4 +187,58 @@ namespace etrobocon2023_test {
     EXPECT_EQ(expected, actual);
   }
 
+  TEST(ArmMotionTest, runProfiledPlusAngle)
+  {
+    // PWMの初期化
+    Controller::stopArmMotor();
+    // アームモータ角位置を初期化
+    Measurer::resetArmMotorCount();
+    int armTargetAngle = 60;
+    int armPwm = 40;
+    ArmMotion am(armTargetAngle, armPwm);
+    am.setProfile(150.0, 600.0);
+
+    // 初期値
+    int ArmMotorCount = Measurer::getArmMotorCount();
+
+    // 期待するアーム角位置
+    int expected = -60;
+
+    am.run();  // アーム動作を実行
+
+    // 関数実行後のアーム角位置
+    int actual = Measurer::getArmMotorCount() - ArmMotorCount;
+
+    // アーム角位置のテスト(目標角位置で静定している)
+    EXPECT_NEAR(expected, actual, ArmController::SETTLE_TOLERANCE);
+    EXPECT_TRUE(am.isSettled());
+  }
+
+  TEST(ArmMotionTest, runProfiledMinusAngle)
+  {
+    // PWMの初期化
+    Controller::stopArmMotor();
+    // アームモータ角位置を初期化
+    Measurer::resetArmMotorCount();
+    int armTargetAngle = -60;
+    int armPwm = 40;
+    ArmMotion am(armTargetAngle, armPwm);
+    am.setProfile(300.0, 1200.0);
+
+    // 初期値
+    int ArmMotorCount = Measurer::getArmMotorCount();
+
+    // 期待するアーム角位置
+    int expected = 60;
+
+    am.run();  // アーム動作を実行
+
+    // 関数実行後のアーム角位置
+    int actual = Measurer::getArmMotorCount() - ArmMotorCount;
+
+    // アーム角位置のテスト(目標角位置で静定している)
+    EXPECT_NEAR(expected, actual, ArmController::SETTLE_TOLERANCE);
+    EXPECT_TRUE(am.isSettled());
+  }
+
 }  // namespace etrobocon2023_test
\ No newline at end of file
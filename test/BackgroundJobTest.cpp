@@ -0,0 +1,61 @@
+/**
+ * @file   BackgroundJobTest.cpp
+ * @brief  BackgroundJobクラスのテスト
+ * @author KatLab
+ */
+
+#include "BackgroundJob.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(BackgroundJobTest, runInParallel)
+  {
+    const char* filePath = "background_job_test.txt";
+    remove(filePath);
+    BackgroundJob job("write", "sleep 0.2 && echo done > background_job_test.txt");
+    ASSERT_TRUE(job.start());
+
+    // 開始直後はまだコマンドが完了していない
+    FILE* fp = fopen(filePath, "r");
+    EXPECT_EQ(nullptr, fp);
+    if(fp != NULL) fclose(fp);
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    int status = job.join();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // 合流点で完了を待ってから戻る
+    EXPECT_EQ(0, status);
+    fp = fopen(filePath, "r");
+    EXPECT_NE(nullptr, fp);
+    if(fp != NULL) fclose(fp);
+    remove(filePath);
+    EXPECT_NE(string::npos, output.find("Background job 'write' finished (status: 0"));
+  }
+
+  TEST(BackgroundJobTest, failedCommand)
+  {
+    BackgroundJob job("fail", "exit 3");
+    ASSERT_TRUE(job.start());
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    int status = job.join();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // 失敗した場合は終了ステータスを返してWarningを出す
+    EXPECT_EQ(3, status);
+    EXPECT_NE(string::npos, output.find("Warning"));
+    // 2回目以降のjoinは待たずに同じ終了ステータスを返す
+    EXPECT_EQ(3, job.join());
+  }
+
+  TEST(BackgroundJobTest, joinWithoutStart)
+  {
+    BackgroundJob job("not started", "true");
+    EXPECT_EQ(-1, job.join());
+    EXPECT_EQ(0u, job.getDuration());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,121 @@
+/**
+ * @file   BrightnessStatisticsTest.cpp
+ * @brief  BrightnessStatisticsクラスとBrightnessLinearizerクラスのテスト
+ * @author KatLab
+ */
+
+#include "BrightnessStatistics.h"
+#include "BrightnessLinearizer.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <math.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 白(90)から黒(10)へ一定の速さでラインを横切ったときの輝度を模擬する
+  // 縁では輝度が位置の2乗に比例して変わる(非線形な)センサとする
+  static void addSweepSamples(BrightnessStatistics& statistics)
+  {
+    for(int i = 0; i < 100; i++) statistics.addSample(90);
+    for(int i = 0; i <= 100; i++) {
+      double position = i / 100.0;  // 縁の中の位置(0:黒側, 1:白側)
+      statistics.addSample(static_cast<int>(10 + 80 * position * position));
+    }
+    for(int i = 0; i < 100; i++) statistics.addSample(10);
+  }
+
+  TEST(BrightnessStatisticsTest, statistics)
+  {
+    BrightnessStatistics statistics;
+    for(int i = 0; i < 50; i++) {
+      statistics.addSample(10);
+      statistics.addSample(90);
+    }
+    statistics.addSample(150);  // 範囲外は100として集計する
+
+    EXPECT_EQ(101, statistics.getSampleCount());
+    EXPECT_EQ(10, statistics.getMin());
+    EXPECT_EQ(100, statistics.getMax());
+    EXPECT_NEAR((10.0 * 50 + 90.0 * 50 + 100.0) / 101, statistics.getMean(), 1e-9);
+    EXPECT_NEAR(40.0, statistics.getStandardDeviation(), 1.0);
+  }
+
+  TEST(BrightnessStatisticsTest, calcThreshold)
+  {
+    BrightnessStatistics statistics;
+    for(int i = 0; i < 100; i++) {
+      statistics.addSample(8 + i % 5);   // 黒(8~12)
+      statistics.addSample(88 + i % 5);  // 白(88~92)
+    }
+    // 2つの山の間で分ける
+    int threshold = statistics.calcThreshold();
+    EXPECT_LT(12, threshold);
+    EXPECT_GE(88, threshold);
+    EXPECT_DOUBLE_EQ(10.0, statistics.calcBlackLevel());
+    EXPECT_DOUBLE_EQ(90.0, statistics.calcWhiteLevel());
+  }
+
+  TEST(BrightnessStatisticsTest, emptyStatistics)
+  {
+    BrightnessStatistics statistics;
+    EXPECT_EQ(0, statistics.getSampleCount());
+    EXPECT_DOUBLE_EQ(0.0, statistics.getMean());
+    EXPECT_DOUBLE_EQ(0.0, statistics.getStandardDeviation());
+    EXPECT_EQ(0, statistics.calcThreshold());
+  }
+
+  TEST(BrightnessStatisticsTest, buildTransferFunction)
+  {
+    BrightnessStatistics statistics;
+    addSweepSamples(statistics);
+    double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];
+    statistics.buildTransferFunction(table);
+
+    // 変換表は単調増加
+    for(int i = 1; i < BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT; i++) {
+      EXPECT_LE(table[i - 1], table[i]);
+    }
+    // 黒と白の輝度の外側は生の輝度のまま
+    EXPECT_DOUBLE_EQ(5.0, table[5]);
+    EXPECT_DOUBLE_EQ(95.0, table[95]);
+    // 縁の中では位置に比例する輝度に近づく(位置0.5の生の輝度30は黒と白の中間の50付近へ)
+    // 輝度が整数に丸められるため、黒の輝度10に丸められた位置の分だけずれが残る
+    EXPECT_NEAR(50.0, table[30], 6.0);
+    int rawBrightnesses[] = { 13, 30, 55, 75 };
+    for(int raw : rawBrightnesses) {
+      double idealBrightness = 10.0 + 80.0 * sqrt((raw - 10) / 80.0);  // 位置に比例する輝度
+      EXPECT_GT(fabs(raw - idealBrightness), fabs(table[raw] - idealBrightness));
+    }
+  }
+
+  TEST(BrightnessStatisticsTest, linearizeAndSave)
+  {
+    BrightnessStatistics statistics;
+    addSweepSamples(statistics);
+    double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];
+    statistics.buildTransferFunction(table);
+
+    // 無効な場合は生の輝度のまま
+    BrightnessLinearizer::clear();
+    EXPECT_DOUBLE_EQ(30.0, BrightnessLinearizer::linearize(30.0));
+    EXPECT_FALSE(BrightnessLinearizer::save("brightness_linearizer_test.csv"));
+
+    BrightnessLinearizer::setTable(table);
+    EXPECT_TRUE(BrightnessLinearizer::isEnabled());
+    EXPECT_DOUBLE_EQ(table[30], BrightnessLinearizer::linearize(30.0));
+    // 整数でない輝度は前後の値を補間する
+    EXPECT_DOUBLE_EQ((table[30] + table[31]) / 2.0, BrightnessLinearizer::linearize(30.5));
+
+    // 保存して読み込み直しても同じ変換になる
+    ASSERT_TRUE(BrightnessLinearizer::save("brightness_linearizer_test.csv"));
+    BrightnessLinearizer::clear();
+    ASSERT_TRUE(BrightnessLinearizer::load("brightness_linearizer_test.csv"));
+    remove("brightness_linearizer_test.csv");
+    EXPECT_NEAR(table[30], BrightnessLinearizer::linearize(30.0), 1e-6);
+
+    BrightnessLinearizer::clear();
+    EXPECT_FALSE(BrightnessLinearizer::load("not_exist_transfer.csv"));
+    EXPECT_FALSE(BrightnessLinearizer::isEnabled());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,50 @@
+/**
+ * @file   BrightnessSweepTest.cpp
+ * @brief  BrightnessSweepクラスのテスト
+ * @author KatLab
+ */
+
+#include "BrightnessSweep.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(BrightnessSweepTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    srand(0);
+    LateralOffsetEstimator::clear();
+    BrightnessSweep bs(30.0, 40);
+
+    bs.run();
+    bool isEnabled = LateralOffsetEstimator::isEnabled();
+    LateralOffsetEstimator::clear();
+    remove(LateralOffsetEstimator::DEFAULT_FILE_PATH);
+
+    // 変換表を作り、回頭後はほぼ元の向きに戻っている
+    EXPECT_TRUE(isEnabled);
+    Odometry::update();
+    EXPECT_NEAR(0.0, Odometry::getPose().theta * 180.0 / M_PI, 5.0);
+  }
+
+  TEST(BrightnessSweepTest, runInvalidParameter)
+  {
+    LateralOffsetEstimator::clear();
+    BrightnessSweep zeroPwm(30.0, 0);
+    BrightnessSweep tooLargeAngle(120.0, 40);
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    zeroPwm.run();
+    tooLargeAngle.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos, output.find("The pwm value passed to BrightnessSweep is 0"));
+    EXPECT_NE(string::npos,
+              output.find("The sweepAngle value passed to BrightnessSweep is 120.00"));
+    EXPECT_FALSE(LateralOffsetEstimator::isEnabled());
+  }
+}  // namespace etrobocon2023_test
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <gtest/internal/gtest-port.h>
 #include <time.h>
+#include <stdio.h>
 
 using namespace std;
 
@@ -90,4 +91,147 @@ namespace etrobocon2023_test {
 
     EXPECT_EQ(expected, actual);  // 出力とゲッタの値が等しいかテスト
   }
-}  // namespace etrobocon2023_test
\ No newline at end of file
+
+  TEST(CalibratorTest, saveAndLoadProfile)
+  {
+    const char* filePath = "calibrator_test_profile.csv";
+    CalibrationProfile expected
+        = { false, 12, 98, 40, { 8, 9, 10 }, { 104, 101, 146 }, 1690000000 };
+    ASSERT_TRUE(Calibrator::saveProfile(filePath, expected));
+
+    CalibrationProfile actual = { true, 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, 0 };
+    ASSERT_TRUE(Calibrator::loadProfile(filePath, actual));
+    remove(filePath);
+
+    EXPECT_EQ(expected.isLeftCourse, actual.isLeftCourse);
+    EXPECT_EQ(expected.blackBrightness, actual.blackBrightness);
+    EXPECT_EQ(expected.whiteBrightness, actual.whiteBrightness);
+    EXPECT_EQ(expected.targetBrightness, actual.targetBrightness);
+    EXPECT_EQ(expected.blackRgb.b, actual.blackRgb.b);
+    EXPECT_EQ(expected.whiteRgb.r, actual.whiteRgb.r);
+    EXPECT_EQ(expected.timestamp, actual.timestamp);
+  }
+
+  TEST(CalibratorTest, loadIncompleteProfile)
+  {
+    const char* filePath = "calibrator_test_incomplete_profile.csv";
+    FILE* fp = fopen(filePath, "w");
+    ASSERT_NE(nullptr, fp);
+    fprintf(fp, "course,Left\nblackBrightness,10\n");
+    fclose(fp);
+
+    CalibrationProfile profile = { false, 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, 0 };
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    bool isLoaded = Calibrator::loadProfile(filePath, profile);
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+    remove(filePath);
+
+    // 項目が欠けている場合はWarningを出して使わない
+    EXPECT_FALSE(isLoaded);
+    EXPECT_NE(string::npos, output.find("is incomplete"));
+    EXPECT_FALSE(profile.isLeftCourse);
+    EXPECT_FALSE(Calibrator::loadProfile("not_exist_profile.csv", profile));
+  }
+
+  TEST(CalibratorTest, runWithCachedProfile)
+  {
+    const char* filePath = "calibrator_test_cached_profile.csv";
+    CalibrationProfile cached = { false, 10, 90, 43, { 8, 9, 10 }, { 104, 101, 146 }, 1690000000 };
+    ASSERT_TRUE(Calibrator::saveProfile(filePath, cached));
+
+    Calibrator calibrator(filePath);
+    srand(1);  // 右ボタンが先に押されて保存された結果を再利用する乱数シード
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    calibrator.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+    remove(filePath);
+
+    // 測定せずに保存された結果を使う
+    EXPECT_NE(string::npos, output.find("Cached calibration (course: Right, black: 10, white: 90, "
+                                        "target: 43"));
+    EXPECT_NE(string::npos, output.find("Will Run on the Right Course"));
+    EXPECT_EQ(string::npos, output.find("Press the Left Button on the Black"));
+    EXPECT_FALSE(calibrator.getIsLeftCourse());
+    // 黒と白の中間ではなく、保存された目標輝度(大津の方法の閾値など)を使う
+    EXPECT_EQ(43, calibrator.getTargetBrightness());
+  }
+
+  TEST(CalibratorTest, loadProfileWithoutTarget)
+  {
+    const char* filePath = "calibrator_test_legacy_profile.csv";
+    FILE* fp = fopen(filePath, "w");
+    ASSERT_NE(nullptr, fp);
+    fprintf(fp, "course,Left\nblackBrightness,10\nwhiteBrightness,90\nblackRgb,8,9,10\n"
+                "whiteRgb,104,101,146\ntimestamp,1690000000\n");
+    fclose(fp);
+
+    // 目標輝度を保存していない以前の形式は、黒と白の輝度の中間を目標輝度とする
+    CalibrationProfile profile = { false, 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, 0 };
+    EXPECT_TRUE(Calibrator::loadProfile(filePath, profile));
+    remove(filePath);
+    EXPECT_EQ(50, profile.targetBrightness);
+  }
+
+  TEST(CalibratorTest, runAndSaveProfile)
+  {
+    const char* filePath = "calibrator_test_saved_profile.csv";
+    remove(filePath);
+
+    // 保存された結果がない場合は測定し、結果を保存する
+    Calibrator calibrator(filePath);
+    srand(2);
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    calibrator.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    CalibrationProfile saved = { true, 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, 0 };
+    ASSERT_TRUE(Calibrator::loadProfile(filePath, saved));
+    remove(filePath);
+
+    EXPECT_NE(string::npos, output.find("Press the Left Button on the Black"));
+    EXPECT_EQ(calibrator.getIsLeftCourse(), saved.isLeftCourse);
+    int expectedBrightness = (saved.whiteBrightness + saved.blackBrightness) / 2;
+    EXPECT_EQ(expectedBrightness, calibrator.getTargetBrightness());
+    EXPECT_EQ(expectedBrightness, saved.targetBrightness);
+    EXPECT_EQ(calibrator.getProfile().blackRgb.r, saved.blackRgb.r);
+  }
+
+  TEST(CalibratorTest, runWithSweep)
+  {
+    const char* profilePath = "calibrator_test_sweep_profile.csv";
+    const char* transferPath = "calibrator_test_sweep_transfer.csv";
+    remove(profilePath);
+    remove(transferPath);
+
+    // 中央ボタンが押されるまで繰り返し、ラインを横切る間の輝度の分布から目標輝度を求める
+    Calibrator calibrator(profilePath, transferPath);
+    string output;
+    for(unsigned int seed = 0; output.find("Sweep statistics") == string::npos && seed < 20;
+        seed++) {
+      srand(seed);
+      testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+      calibrator.run();
+      output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+    }
+    bool isLinearizerEnabled = BrightnessLinearizer::isEnabled();
+    BrightnessLinearizer::clear();
+    CalibrationProfile saved = { true, 0, 0, 0, { 0, 0, 0 }, { 0, 0, 0 }, 0 };
+    bool isProfileSaved = Calibrator::loadProfile(profilePath, saved);
+    FILE* fp = fopen(transferPath, "r");
+    bool isTransferSaved = fp != NULL;
+    if(fp != NULL) fclose(fp);
+    remove(profilePath);
+    remove(transferPath);
+
+    // ダミーのカラーセンサは黒と白を含む6色を返すため、黒と白を区別できる
+    ASSERT_NE(string::npos, output.find("Sweep statistics"));
+    EXPECT_EQ(string::npos, output.find("Press the Left Button on the White"));
+    EXPECT_TRUE(isLinearizerEnabled);
+    EXPECT_TRUE(isTransferSaved);
+    EXPECT_LT(calibrator.getProfile().blackBrightness, calibrator.getTargetBrightness());
+    EXPECT_GT(calibrator.getProfile().whiteBrightness, calibrator.getTargetBrightness());
+    // 次回の起動で同じ目標輝度を使えるよう、大津の方法の閾値を保存する
+    EXPECT_TRUE(isProfileSaved);
+    EXPECT_EQ(calibrator.getTargetBrightness(), saved.targetBrightness);
+  }
+}  // namespace etrobocon2023_test
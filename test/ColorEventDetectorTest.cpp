@@ -0,0 +1,114 @@
+/**
+ * @file   ColorEventDetectorTest.cpp
+ * @brief  ColorEventDetectorクラスのテスト
+ * @author KatLab
+ */
+
+#include "ColorEventDetector.h"
+#include "ColorLineTracing.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // x軸正方向に1周期2mmずつ進みながら色判定を与える
+  static bool updateAt(ColorEventDetector& detector, int step, COLOR color)
+  {
+    Pose pose = { step * 2.0, 0.0, 0.0 };
+    return detector.update(color, pose);
+  }
+
+  TEST(ColorEventDetectorTest, detect)
+  {
+    ColorEventDetector detector(COLOR::BLUE);
+    COLOR colors[]
+        = { COLOR::WHITE, COLOR::WHITE, COLOR::BLUE, COLOR::BLUE, COLOR::BLUE, COLOR::BLUE };
+    for(int i = 0; i < 4; i++) {
+      EXPECT_FALSE(updateAt(detector, i, colors[i]));
+    }
+    // 3票そろったら疑いあり、始まりは窓内で最初の青
+    EXPECT_FALSE(updateAt(detector, 4, colors[4]));
+    EXPECT_EQ(COLOR_EVENT_STATE::CANDIDATE, detector.getState());
+    EXPECT_DOUBLE_EQ(4.0, detector.getStartPose().x);
+
+    // 始まりから確定距離(5mm)を走ったら確定する
+    EXPECT_TRUE(updateAt(detector, 5, colors[5]));
+    EXPECT_EQ(COLOR_EVENT_STATE::DETECTED, detector.getState());
+    EXPECT_DOUBLE_EQ(6.0, detector.getOvershootDistance());
+    EXPECT_DOUBLE_EQ(4.0, detector.getStartPose().x);
+  }
+
+  TEST(ColorEventDetectorTest, ignoreNoise)
+  {
+    ColorEventDetector detector(COLOR::RED);
+    // 単発の誤判定では疑いにならない
+    COLOR colors[] = { COLOR::RED,   COLOR::WHITE, COLOR::WHITE, COLOR::RED,   COLOR::WHITE,
+                       COLOR::WHITE, COLOR::WHITE, COLOR::RED,   COLOR::WHITE, COLOR::WHITE };
+    for(int i = 0; i < 10; i++) {
+      EXPECT_FALSE(updateAt(detector, i, colors[i]));
+      EXPECT_EQ(COLOR_EVENT_STATE::ABSENT, detector.getState());
+    }
+  }
+
+  TEST(ColorEventDetectorTest, hysteresis)
+  {
+    ColorEventDetector detector(COLOR::GREEN, 5, 3, 1, 10.0);
+    int step = 0;
+    for(int i = 0; i < 3; i++) {
+      updateAt(detector, step++, COLOR::GREEN);
+    }
+    EXPECT_EQ(COLOR_EVENT_STATE::CANDIDATE, detector.getState());
+
+    // 区間の途中の1回の誤判定では疑いは解けず、確定まで進む
+    EXPECT_FALSE(updateAt(detector, step++, COLOR::BLACK));
+    EXPECT_EQ(COLOR_EVENT_STATE::CANDIDATE, detector.getState());
+    EXPECT_FALSE(updateAt(detector, step++, COLOR::GREEN));
+    EXPECT_TRUE(updateAt(detector, step++, COLOR::GREEN));
+
+    // 票数がEXIT_VOTE以下になるまでは確定を保つ
+    EXPECT_TRUE(updateAt(detector, step++, COLOR::WHITE));
+    EXPECT_TRUE(updateAt(detector, step++, COLOR::WHITE));
+    EXPECT_TRUE(updateAt(detector, step++, COLOR::WHITE));
+    EXPECT_FALSE(updateAt(detector, step++, COLOR::WHITE));
+    EXPECT_EQ(COLOR_EVENT_STATE::ABSENT, detector.getState());
+  }
+
+  TEST(ColorEventDetectorTest, notConfirmWithoutMoving)
+  {
+    ColorEventDetector detector(COLOR::YELLOW);
+    Pose pose = { 10.0, 5.0, 0.0 };
+    for(int i = 0; i < 10; i++) {
+      EXPECT_FALSE(detector.update(COLOR::YELLOW, pose));
+    }
+    EXPECT_EQ(COLOR_EVENT_STATE::CANDIDATE, detector.getState());
+
+    detector.reset();
+    EXPECT_EQ(COLOR_EVENT_STATE::ABSENT, detector.getState());
+    EXPECT_DOUBLE_EQ(0.0, detector.getOvershootDistance());
+  }
+
+  TEST(ColorEventDetectorTest, detectBySingleSample)
+  {
+    // 窓の大きさ1・確定距離0の場合は1回の判定で確定する
+    ColorEventDetector detector(COLOR::BLUE, 1, 1, 0, 0.0);
+    EXPECT_FALSE(updateAt(detector, 0, COLOR::WHITE));
+    EXPECT_TRUE(updateAt(detector, 1, COLOR::BLUE));
+    EXPECT_DOUBLE_EQ(0.0, detector.getOvershootDistance());
+    EXPECT_DOUBLE_EQ(2.0, detector.getStartPose().x);
+  }
+
+  TEST(ColorEventDetectorTest, detectByConsecutiveSamples)
+  {
+    // ColorLineTracingと同じ設定では、連続してJUDGE_COUNT回取得した時点で確定する
+    const int JUDGE_COUNT = ColorLineTracing::JUDGE_COUNT;
+    ColorEventDetector detector(COLOR::BLUE, JUDGE_COUNT, JUDGE_COUNT, 0, 0.0);
+    COLOR colors[] = { COLOR::WHITE, COLOR::BLUE, COLOR::WHITE, COLOR::BLUE, COLOR::BLUE };
+    for(int i = 0; i < 5; i++) {
+      EXPECT_FALSE(updateAt(detector, i, colors[i]));
+    }
+    // 停止位置は青が続き始めた位置から(JUDGE_COUNT - 1)周期分だけ先になる
+    EXPECT_TRUE(updateAt(detector, 5, COLOR::BLUE));
+    EXPECT_DOUBLE_EQ(6.0, detector.getStartPose().x);
+    EXPECT_DOUBLE_EQ((JUDGE_COUNT - 1) * 2.0, detector.getOvershootDistance());
+  }
+}  // namespace etrobocon2023_test
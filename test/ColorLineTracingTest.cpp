@@ -7,13 +7,14 @@
 #include "LineTracing.h"
 #include "ColorLineTracing.h"
 #include "Mileage.h"
+#include "Odometry.h"
 #include <gtest/gtest.h>
 #include <gtest/internal/gtest-port.h>
 
 using namespace std;
 
 namespace etrobocon2023_test {
-  // 最初3回の色取得で連続して指定色を取得するテストケース
+  // 最初の色取得から連続して指定色を取得するテストケース
   TEST(ColorLineTracingTest, runToGetFirst)
   {
     // PWMの初期化
@@ -32,7 +33,7 @@ namespace etrobocon2023_test {
     int initialLeftCount = Measurer::getLeftCount();
     double expected = Mileage::calculateMileage(initialRightCount, initialLeftCount);
 
-    srand(9037);  // 3回連続して緑を取得する乱数シード
+    srand(9037);  // 最初に続けて緑を取得する乱数シード
     cl.run();     // 緑までライントレースを実行
 
     // ライントレース後の走行距離
@@ -235,4 +236,33 @@ namespace etrobocon2023_test {
     EXPECT_EQ(expectedOutput, actualOutput);  // 標準出力でWarningを出している
     EXPECT_EQ(expected, actual);  // ライントレース前後で走行距離に変化はない
   }
+
+  // 指定色の区間が始まった位置から行き過ぎずに止まるテストケース
+  TEST(ColorLineTracingTest, stopAtColorEdge)
+  {
+    // PWMの初期化
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    COLOR targetColor = COLOR::BLUE;
+    double targetSpeed = 100.0;
+    double targetBrightness = 45.0;
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    bool isLeftEdge = true;
+    ColorLineTracing cl(targetColor, targetSpeed, targetBrightness, gain, isLeftEdge);
+
+    /**
+     * 青の区間が始まってから(JUDGE_COUNT - 1)周期分の走行距離を許容誤差とする
+     * 一回のsetPWM()でダミーのモータカウントに加算される値は最大でPWM値100 * 0.05
+     */
+    double error = (ColorLineTracing::JUDGE_COUNT - 1) * Mileage::calculateMileage(5, 5);
+
+    srand(0);  // 最初に識別する色が青ではない乱数シード
+    cl.run();  // 青までライントレースを実行
+
+    // 停止位置(最後に判定した位置)と青の区間が始まった位置の距離
+    Pose startPose = cl.getColorStartPose();
+    double actual = Odometry::calcDistanceTo(startPose.x, startPose.y);
+
+    EXPECT_GE(error, actual);  // 青の区間の始まりから許容誤差以内で止まっている
+  }
 }  // namespace etrobocon2023_test
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Measurer.h"
 #include "Mileage.h"
 #include "ColorStraight.h"
+#include "Odometry.h"
 
 using namespace std;
 
@@ -172,4 +173,24 @@ namespace etrobocon2023_test {
     EXPECT_EQ(expected, actual);              // 直進前後で走行距離に変化はない
   }
 
-}  // namespace etrobocon2023_test
\ No newline at end of file
+  // 目標色の区間が始まった位置で止まるテストケース
+  TEST(ColorStraightTest, stopAtColorEdge)
+  {
+    // PWMの初期化
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    COLOR targetColor = COLOR::BLUE;
+    int targetSpeed = 1000;
+    ColorStraight cs(targetColor, targetSpeed);
+
+    srand(89);  // 最初10回が青を取得しない乱数シード
+    cs.run();   // 青まで直進を実行
+
+    // 停止位置(最後に判定した位置)と青の区間が始まった位置の距離
+    Pose startPose = cs.getColorStartPose();
+    double actual = Odometry::calcDistanceTo(startPose.x, startPose.y);
+
+    EXPECT_DOUBLE_EQ(0.0, actual);  // 青を最初に取得した位置で止まっている
+  }
+
+}  // namespace etrobocon2023_test
@@ -67,4 +67,73 @@ namespace etrobocon2023_test {
     SUCCEED();
   }
 
+  TEST(ControllerTest, voltageCompensationDisabled)
+  {
+    Controller::setVoltageCompensation(false);
+    Controller::updateVoltage(4.0);
+    // 補正が無効の場合は電圧が下がっても補正比率は1.0のまま
+    EXPECT_DOUBLE_EQ(1.0, Controller::getVoltageCompensationRatio());
+  }
+
+  TEST(ControllerTest, voltageCompensationLowVoltage)
+  {
+    const int pwm = 60;
+    const int loopCount = 10;
+
+    // 補正なしでPWM値をセットしたときの角位置の変化量
+    Controller::setVoltageCompensation(false);
+    int initCount = Measurer::getRightCount();
+    for(int i = 0; i < loopCount; i++) {
+      Controller::setRightMotorPwm(pwm);
+    }
+    int uncompensatedDiff = Measurer::getRightCount() - initCount;
+
+    // 電圧が十分に下がるまで測定を繰り返す
+    Controller::setVoltageCompensation(true);
+    for(int i = 0; i < 50; i++) {
+      Controller::updateVoltage(4.0);
+    }
+    EXPECT_NEAR(4.0, Controller::getFilteredVoltage(), 0.01);
+    // 補正比率は上限(1.3)に制限される
+    EXPECT_DOUBLE_EQ(1.3, Controller::getVoltageCompensationRatio());
+
+    // 補正ありでPWM値をセットしたときの角位置の変化量
+    initCount = Measurer::getRightCount();
+    for(int i = 0; i < loopCount; i++) {
+      Controller::setRightMotorPwm(pwm);
+    }
+    int compensatedDiff = Measurer::getRightCount() - initCount;
+
+    EXPECT_LT(uncompensatedDiff, compensatedDiff);  // 補正した分だけ多く回転する
+    EXPECT_DOUBLE_EQ(pwm, Controller::getRightPwm());  // 保持するPWM値は補正前の値
+    Controller::setVoltageCompensation(false);
+    Controller::stopMotor();
+  }
+
+  TEST(ControllerTest, voltageCompensationHighVoltage)
+  {
+    Controller::setVoltageCompensation(true);
+    for(int i = 0; i < 50; i++) {
+      Controller::updateVoltage(20.0);
+    }
+    // 補正比率は下限(0.8)に制限される
+    EXPECT_DOUBLE_EQ(0.8, Controller::getVoltageCompensationRatio());
+    Controller::setVoltageCompensation(false);
+    EXPECT_DOUBLE_EQ(1.0, Controller::getVoltageCompensationRatio());
+  }
+
+  TEST(ControllerTest, voltageCompensationNominalVoltage)
+  {
+    Controller::setVoltageCompensation(true);
+    for(int i = 0; i < 100; i++) {
+      Controller::updateVoltage(7.3);
+    }
+    // 基準電圧では補正しない
+    EXPECT_NEAR(1.0, Controller::getVoltageCompensationRatio(), 0.001);
+    // 不正な測定値は無視する
+    Controller::updateVoltage(0.0);
+    EXPECT_NEAR(7.3, Controller::getFilteredVoltage(), 0.001);
+    Controller::setVoltageCompensation(false);
+  }
+
 }  // namespace etrobocon2023_test
\ No newline at end of file
@@ -0,0 +1,132 @@
+/**
+ * @file   CooperativeSchedulerTest.cpp
+ * @brief  CooperativeSchedulerクラスのテスト
+ * @author KatLab
+ */
+
+#include "CooperativeScheduler.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 指定した回数だけ進むと終わるテスト用のタスク
+  class CountingTask : public CooperativeTask {
+   public:
+    CountingTask(int _maxCount, int* _order = nullptr, int _id = 0)
+      : maxCount(_maxCount), count(0), order(_order), id(_id)
+    {
+    }
+
+    bool resume() override
+    {
+      count++;
+      // 進んだ順番を記録する
+      if(order != nullptr) {
+        *order = *order * 10 + id;
+      }
+      return count < maxCount;
+    }
+
+    int maxCount;
+    int count;
+    int* order;
+    int id;
+  };
+
+  TEST(CooperativeSchedulerTest, tick)
+  {
+    CooperativeScheduler::clear();
+    CountingTask task1(1);
+    CountingTask task2(3);
+    EXPECT_TRUE(CooperativeScheduler::add(&task1));
+    EXPECT_TRUE(CooperativeScheduler::add(&task2));
+    EXPECT_EQ(2, CooperativeScheduler::getTaskCount());
+
+    // 終わったタスクは外れ、残りのタスクだけが進む
+    CooperativeScheduler::tick();
+    EXPECT_FALSE(CooperativeScheduler::isScheduled(&task1));
+    EXPECT_TRUE(CooperativeScheduler::isScheduled(&task2));
+    CooperativeScheduler::tick();
+    CooperativeScheduler::tick();
+    EXPECT_EQ(1, task1.count);
+    EXPECT_EQ(3, task2.count);
+    EXPECT_EQ(0, CooperativeScheduler::getTaskCount());
+  }
+
+  TEST(CooperativeSchedulerTest, tickInOrder)
+  {
+    CooperativeScheduler::clear();
+    int order = 0;
+    CountingTask task1(2, &order, 1);
+    CountingTask task2(2, &order, 2);
+    CountingTask task3(2, &order, 3);
+    CooperativeScheduler::add(&task1);
+    CooperativeScheduler::add(&task2);
+    CooperativeScheduler::add(&task3);
+
+    // 登録を解除したタスクは進まず、残りは登録順に進む
+    CooperativeScheduler::remove(&task2);
+    CooperativeScheduler::tick();
+    CooperativeScheduler::tick();
+    EXPECT_EQ(1313, order);
+    EXPECT_EQ(0, task2.count);
+  }
+
+  TEST(CooperativeSchedulerTest, addRejected)
+  {
+    CooperativeScheduler::clear();
+    CountingTask task(1);
+    EXPECT_TRUE(CooperativeScheduler::add(&task));
+    // 二重に登録しない
+    EXPECT_FALSE(CooperativeScheduler::add(&task));
+    EXPECT_FALSE(CooperativeScheduler::add(nullptr));
+    CooperativeScheduler::clear();
+
+    // 登録数の上限を超えて登録しない
+    CountingTask tasks[CooperativeScheduler::MAX_TASK_COUNT + 1] = {
+      CountingTask(1), CountingTask(1), CountingTask(1), CountingTask(1), CountingTask(1),
+      CountingTask(1), CountingTask(1), CountingTask(1), CountingTask(1)
+    };
+    for(int i = 0; i < CooperativeScheduler::MAX_TASK_COUNT; i++) {
+      EXPECT_TRUE(CooperativeScheduler::add(&tasks[i]));
+    }
+    EXPECT_FALSE(CooperativeScheduler::add(&tasks[CooperativeScheduler::MAX_TASK_COUNT]));
+    CooperativeScheduler::clear();
+  }
+
+  TEST(CooperativeSchedulerTest, runUntilFinished)
+  {
+    CooperativeScheduler::clear();
+    CountingTask shortTask(3);
+    CountingTask longTask(10);
+    CooperativeScheduler::add(&shortTask);
+    CooperativeScheduler::add(&longTask);
+    Timer timer;
+    uint64_t startTime = timer.nowMicro();
+
+    CooperativeScheduler::runUntilFinished(&shortTask);
+
+    // 待ったタスクが終わった時点で戻り、他のタスクも同じ周期で進んでいる
+    EXPECT_FALSE(CooperativeScheduler::isScheduled(&shortTask));
+    EXPECT_EQ(3, longTask.count);
+    EXPECT_LE(2 * CooperativeScheduler::TICK_PERIOD * 1000, timer.nowMicro() - startTime);
+    CooperativeScheduler::clear();
+  }
+
+  TEST(CooperativeSchedulerTest, sleep)
+  {
+    CooperativeScheduler::clear();
+    CountingTask task(100);
+    CooperativeScheduler::add(&task);
+    Timer timer;
+    uint64_t startTime = timer.nowMicro();
+
+    CooperativeScheduler::sleep(50);
+
+    // スリープ中もティックの周期ごとにタスクが進む
+    EXPECT_LE(50000, timer.nowMicro() - startTime);
+    EXPECT_EQ(50 / CooperativeScheduler::TICK_PERIOD, task.count);
+    CooperativeScheduler::clear();
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,80 @@
+/**
+ * @file   CurvatureSpeedPlannerTest.cpp
+ * @brief  CurvatureSpeedPlannerクラスのテスト
+ * @author KatLab
+ */
+
+#include "CurvatureSpeedPlanner.h"
+#include "Controller.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(CurvatureSpeedPlannerTest, calcTurnCurvature)
+  {
+    EXPECT_DOUBLE_EQ(0.0, CurvatureSpeedPlanner::calcTurnCurvature(10.0, 0.0));
+    EXPECT_DOUBLE_EQ(0.0, CurvatureSpeedPlanner::calcTurnCurvature(0.0, 50.0));
+    // 旋回値の向きによらず大きさを返す
+    double expected = 2.0 * 10.0 / 50.0 / TREAD;
+    EXPECT_DOUBLE_EQ(expected, CurvatureSpeedPlanner::calcTurnCurvature(10.0, 50.0));
+    EXPECT_DOUBLE_EQ(expected, CurvatureSpeedPlanner::calcTurnCurvature(-10.0, 50.0));
+  }
+
+  // 直線では最高速度まで加速度の上限を守って加速する
+  TEST(CurvatureSpeedPlannerTest, accelerateOnStraight)
+  {
+    Timer timer;
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    double minSpeed = 150.0;
+    double maxSpeed = 400.0;
+    CurvatureSpeedPlanner planner(minSpeed, maxSpeed);
+    EXPECT_DOUBLE_EQ(minSpeed, planner.getSpeed());
+
+    double prevSpeed = planner.getSpeed();
+    double speed = prevSpeed;
+    for(int i = 0; i < 200; i++) {
+      speed = planner.calculateSpeed(0.0, 50.0, 0.01);
+      EXPECT_GE(CurvatureSpeedPlanner::ACCELERATION * 0.01 + 1e-9, speed - prevSpeed);
+      prevSpeed = speed;
+      timer.sleep(10);
+    }
+    EXPECT_DOUBLE_EQ(maxSpeed, speed);
+  }
+
+  // 旋回値が大きいカーブでは最低速度まで減速する
+  TEST(CurvatureSpeedPlannerTest, decelerateOnCurve)
+  {
+    Timer timer;
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    double minSpeed = 150.0;
+    double maxSpeed = 400.0;
+    CurvatureSpeedPlanner planner(minSpeed, maxSpeed);
+    for(int i = 0; i < 200; i++) {
+      planner.calculateSpeed(0.0, 50.0, 0.01);
+      timer.sleep(10);
+    }
+
+    // 曲率がCURVE_CURVATUREを超える旋回値
+    double turnPwm = CurvatureSpeedPlanner::CURVE_CURVATURE * TREAD * 50.0;
+    double speed = 0.0;
+    for(int i = 0; i < 100; i++) {
+      speed = planner.calculateSpeed(turnPwm, 50.0, 0.01);
+      timer.sleep(10);
+    }
+    EXPECT_LT(CurvatureSpeedPlanner::CURVE_CURVATURE, planner.getCurvature());
+    EXPECT_DOUBLE_EQ(minSpeed, speed);
+  }
+
+  // 後退時は負の速度を返す
+  TEST(CurvatureSpeedPlannerTest, backward)
+  {
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    CurvatureSpeedPlanner planner(-150.0, -400.0);
+    EXPECT_DOUBLE_EQ(-150.0, planner.getSpeed());
+    EXPECT_GT(-150.0, planner.calculateSpeed(0.0, -50.0, 0.01));
+  }
+}  // namespace etrobocon2023_test
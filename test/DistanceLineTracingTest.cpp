@@ -146,6 +146,106 @@ namespace etrobocon2023_test {
     EXPECT_LT(expected - error, actual);  // ライントレース後に走行した距離が許容誤差未満である
   }
 
+  TEST(DistanceLineTracingTest, runGainScheduled)
+  {
+    // PWMの初期化
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    double targetSpeed = 100.0;
+    double targetDistance = 1000.0;
+    double targetBrightness = 45.0;
+    double basePwm = 100;
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    PidGain curveGain = { 0.9, 0.1, 0.1 };
+    bool isLeftEdge = true;
+    DistanceLineTracing dl(targetDistance, targetSpeed, targetBrightness, gain, isLeftEdge);
+    dl.addGainScheduleLevel(targetSpeed, gain, curveGain);
+
+    // 初期値から期待する走行距離を求める
+    int initialRightCount = Measurer::getRightCount();
+    int initialLeftCount = Measurer::getLeftCount();
+    double expected
+        = Mileage::calculateMileage(initialRightCount, initialLeftCount) + targetDistance;
+
+    // 一回のsetPWM()でダミーのモータカウントに加算される値はpwm * 0.05
+    double error = Mileage::calculateMileage(basePwm * 0.05, basePwm * 0.05);  // 許容誤差
+
+    dl.run();  // ゲインスケジュールを有効にしてライントレースを実行
+
+    // ライントレース後の走行距離
+    int rightCount = Measurer::getRightCount();
+    int leftCount = Measurer::getLeftCount();
+    double actual = Mileage::calculateMileage(rightCount, leftCount);
+
+    EXPECT_LE(expected, actual);  // ライントレース後に走行した距離が期待する走行距離以上である
+    EXPECT_GT(expected + error, actual);  // ライントレース後に走行した距離が許容誤差未満である
+  }
+
+  TEST(DistanceLineTracingTest, runSpeedAdaptive)
+  {
+    // PWMの初期化
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    double targetDistance = 1000.0;
+    double targetBrightness = 45.0;
+    double basePwm = 100;
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    bool isLeftEdge = true;
+    DistanceLineTracing dl(targetDistance, 400.0, targetBrightness, gain, isLeftEdge);
+    dl.setSpeedRange(150.0, 400.0);
+
+    // 初期値から期待する走行距離を求める
+    int initialRightCount = Measurer::getRightCount();
+    int initialLeftCount = Measurer::getLeftCount();
+    double expected
+        = Mileage::calculateMileage(initialRightCount, initialLeftCount) + targetDistance;
+
+    // 一回のsetPWM()でダミーのモータカウントに加算される値はpwm * 0.05
+    double error = Mileage::calculateMileage(basePwm * 0.05, basePwm * 0.05);  // 許容誤差
+
+    dl.run();  // 速度適応を有効にしてライントレースを実行
+
+    // ライントレース後の走行距離
+    int rightCount = Measurer::getRightCount();
+    int leftCount = Measurer::getLeftCount();
+    double actual = Mileage::calculateMileage(rightCount, leftCount);
+
+    EXPECT_LE(expected, actual);  // ライントレース後に走行した距離が期待する走行距離以上である
+    EXPECT_GT(expected + error, actual);  // ライントレース後に走行した距離が許容誤差未満である
+  }
+
+  // 線形化した輝度を入力にする場合は変換表を使い、変換表がなければwarningを出して輝度のまま使う
+  TEST(DistanceLineTracingTest, runLinearizedInput)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    double targetDistance = 200.0;
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    bool isLeftEdge = true;
+    DistanceLineTracing dl(targetDistance, 300.0, 45, gain, isLeftEdge);
+    dl.setLinearizedInput();
+
+    double table[BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT];
+    for(int i = 0; i < BrightnessStatistics::BRIGHTNESS_LEVEL_COUNT; i++) {
+      table[i] = i < 45 ? i * 0.5 : 22.5 + (i - 45) * 1.5;
+    }
+    BrightnessLinearizer::setTable(table);
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    dl.run();
+    dl.logRunning();
+    string linearizedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    BrightnessLinearizer::clear();
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    dl.run();
+    string rawOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(string::npos, linearizedOutput.find("transfer table is not loaded"));
+    EXPECT_NE(string::npos, linearizedOutput.find("Linearized brightness input "
+                                                  "(targetBrightness: 22.50)"));
+    EXPECT_NE(string::npos, rawOutput.find("transfer table is not loaded"));
+  }
+
   TEST(DistanceLineTracingTest, runZeroSpeed)
   {
     // PWMの初期化
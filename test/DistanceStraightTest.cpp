@@ -17,6 +17,8 @@ namespace etrobocon2023_test {
     // PWMの初期化
     Controller::setRightMotorPwm(0.0);
     Controller::setLeftMotorPwm(0.0);
+    // 前のテストの走行速度の推定値を引き継がないよう破棄する
+    SpeedEstimator::reset();
     double targetDistance = 350;
     double targetSpeed = 50;
     DistanceStraight ds(targetDistance, targetSpeed);
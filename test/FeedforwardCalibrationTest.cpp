@@ -0,0 +1,56 @@
+/**
+ * @file   FeedforwardCalibrationTest.cpp
+ * @brief  FeedforwardCalibrationクラスのテスト
+ * @author KatLab
+ */
+
+#include "FeedforwardCalibration.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(FeedforwardCalibrationTest, run)
+  {
+    // 前のテストの角位置と走行速度を引き継がないよう初期化する
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Measurer::resetCount();
+    SpeedEstimator::reset();
+    FeedforwardModel::reset();
+    FeedforwardCalibration ff(30, 70, 20, 400);
+
+    ff.run();
+
+    // ダミーのモータは速度がPWM値に比例するため、不感帯がほぼ0で傾きが正のモデルになる
+    FeedforwardParam right = FeedforwardModel::getRight();
+    FeedforwardParam left = FeedforwardModel::getLeft();
+    EXPECT_NEAR(0.0, right.deadbandPwm, 1.0);
+    EXPECT_LT(0.0, right.slope);
+    EXPECT_NEAR(right.slope, left.slope, 1e-6);
+    // 較正したモデルは次回の起動で使えるよう保存される
+    FeedforwardModel::reset();
+    EXPECT_TRUE(FeedforwardModel::load());
+    EXPECT_NEAR(right.slope, FeedforwardModel::getRight().slope, 1e-6);
+    remove(FeedforwardModel::DEFAULT_FILE_PATH);
+    FeedforwardModel::reset();
+    SpeedEstimator::reset();
+  }
+
+  TEST(FeedforwardCalibrationTest, runInvalidParameter)
+  {
+    FeedforwardModel::reset();
+    testing::internal::CaptureStdout();
+    FeedforwardCalibration invalidRange(70, 30, 20, 400);
+    invalidRange.run();
+    FeedforwardCalibration shortStep(30, 70, 20, 100);
+    shortStep.run();
+    string output = testing::internal::GetCapturedStdout();
+
+    // 引数が不正な場合は走らずにwarningを出し、モデルを変えない
+    EXPECT_NE(string::npos, output.find("The pwm range passed to FeedforwardCalibration"));
+    EXPECT_NE(string::npos, output.find("The stepTime value passed to FeedforwardCalibration"));
+    EXPECT_DOUBLE_EQ(FeedforwardModel::DEFAULT_SLOPE, FeedforwardModel::getRight().slope);
+  }
+}  // namespace etrobocon2023_test
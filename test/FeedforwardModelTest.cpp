@@ -0,0 +1,91 @@
+/**
+ * @file   FeedforwardModelTest.cpp
+ * @brief  FeedforwardModelクラスのテスト
+ * @author KatLab
+ */
+
+#include "FeedforwardModel.h"
+#include "SpeedCalculator.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // テストで使うモデルのファイル
+  static const char* FEEDFORWARD_FILE = "feedforward_test.csv";
+
+  TEST(FeedforwardModelTest, fit)
+  {
+    // 右はPWM = 5 + 0.1 * 速度、左はPWM = 10 + 0.2 * 速度 となるサンプル(左は30で回らない)
+    FeedforwardModel::reset();
+    FeedforwardModel::clearSamples();
+    FeedforwardModel::addSample(30.0, 250.0, 0.0);
+    FeedforwardModel::addSample(50.0, 450.0, 200.0);
+    FeedforwardModel::addSample(70.0, 650.0, 300.0);
+    ASSERT_TRUE(FeedforwardModel::fit());
+
+    // 車輪ごとに当てはめ、回らなかったサンプルは使わない
+    EXPECT_NEAR(5.0, FeedforwardModel::getRight().deadbandPwm, 1e-9);
+    EXPECT_NEAR(0.1, FeedforwardModel::getRight().slope, 1e-9);
+    EXPECT_NEAR(10.0, FeedforwardModel::getLeft().deadbandPwm, 1e-9);
+    EXPECT_NEAR(0.2, FeedforwardModel::getLeft().slope, 1e-9);
+    // SpeedCalculatorのフィードフォワード値に反映される
+    EXPECT_NEAR(45.0, SpeedCalculator::calcRightFeedforwardPwm(400.0), 1e-9);
+    EXPECT_NEAR(-90.0, SpeedCalculator::calcLeftFeedforwardPwm(-400.0), 1e-9);
+    FeedforwardModel::reset();
+  }
+
+  TEST(FeedforwardModelTest, fitFailed)
+  {
+    // 片方の車輪が回ったサンプルが足りない場合はどちらも更新しない
+    FeedforwardModel::reset();
+    FeedforwardModel::clearSamples();
+    FeedforwardModel::addSample(30.0, 250.0, 0.0);
+    FeedforwardModel::addSample(50.0, 450.0, 0.0);
+    FeedforwardModel::addSample(70.0, 650.0, 300.0);
+    EXPECT_FALSE(FeedforwardModel::fit());
+    EXPECT_DOUBLE_EQ(FeedforwardModel::DEFAULT_DEADBAND_PWM,
+                     FeedforwardModel::getRight().deadbandPwm);
+    EXPECT_DOUBLE_EQ(FeedforwardModel::DEFAULT_SLOPE, FeedforwardModel::getLeft().slope);
+
+    // 速度がPWM値に対して減る場合は不正な直線として更新しない
+    FeedforwardModel::clearSamples();
+    FeedforwardModel::addSample(30.0, 300.0, 300.0);
+    FeedforwardModel::addSample(50.0, 200.0, 200.0);
+    EXPECT_FALSE(FeedforwardModel::fit());
+    EXPECT_DOUBLE_EQ(FeedforwardModel::DEFAULT_SLOPE, FeedforwardModel::getRight().slope);
+  }
+
+  TEST(FeedforwardModelTest, saveAndLoad)
+  {
+    FeedforwardModel::set(FeedforwardParam(6.0, 0.12), FeedforwardParam(7.5, 0.11));
+    ASSERT_TRUE(FeedforwardModel::save(FEEDFORWARD_FILE));
+    FeedforwardModel::reset();
+
+    ASSERT_TRUE(FeedforwardModel::load(FEEDFORWARD_FILE));
+    remove(FEEDFORWARD_FILE);
+    EXPECT_NEAR(6.0, FeedforwardModel::getRight().deadbandPwm, 1e-6);
+    EXPECT_NEAR(0.12, FeedforwardModel::getRight().slope, 1e-6);
+    EXPECT_NEAR(7.5, FeedforwardModel::getLeft().deadbandPwm, 1e-6);
+    EXPECT_NEAR(0.11, FeedforwardModel::getLeft().slope, 1e-6);
+    FeedforwardModel::reset();
+  }
+
+  TEST(FeedforwardModelTest, loadIncomplete)
+  {
+    // 左右の組がそろわないファイルは使わない
+    FILE* fp = fopen(FEEDFORWARD_FILE, "w");
+    ASSERT_NE(nullptr, fp);
+    fprintf(fp, "R,6.0,0.12\n");
+    fclose(fp);
+    FeedforwardModel::reset();
+
+    testing::internal::CaptureStdout();
+    EXPECT_FALSE(FeedforwardModel::load(FEEDFORWARD_FILE));
+    testing::internal::GetCapturedStdout();
+    remove(FEEDFORWARD_FILE);
+    EXPECT_DOUBLE_EQ(FeedforwardModel::DEFAULT_SLOPE, FeedforwardModel::getRight().slope);
+    EXPECT_FALSE(FeedforwardModel::load("not_exist_feedforward.csv"));
+  }
+}  // namespace etrobocon2023_test
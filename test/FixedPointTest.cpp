@@ -0,0 +1,97 @@
+/**
+ * @file   FixedPointTest.cpp
+ * @brief  FixedPointクラスと固定小数点数で計算するPIDのテスト
+ * @author KatLab
+ */
+
+#include "FixedPoint.h"
+#include "Pid.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 内部表現1つ分の値
+  constexpr double Q16_16_RESOLUTION = 1.0 / 65536.0;
+
+  TEST(FixedPointTest, convert)
+  {
+    EXPECT_EQ(65536, Q16_16(1).getRaw());
+    EXPECT_EQ(-98304, Q16_16(-1.5).getRaw());
+    EXPECT_DOUBLE_EQ(0.25, static_cast<double>(Q16_16(0.25)));
+    EXPECT_NEAR(0.01, static_cast<double>(Q16_16(0.01)), Q16_16_RESOLUTION);
+    EXPECT_DOUBLE_EQ(1.5, static_cast<double>(Q16_16::fromRaw(98304)));
+  }
+
+  TEST(FixedPointTest, arithmetic)
+  {
+    Q16_16 a(3.25);
+    Q16_16 b(-1.5);
+    EXPECT_DOUBLE_EQ(1.75, static_cast<double>(a + b));
+    EXPECT_DOUBLE_EQ(4.75, static_cast<double>(a - b));
+    EXPECT_DOUBLE_EQ(-4.875, static_cast<double>(a * b));
+    EXPECT_NEAR(-2.1666667, static_cast<double>(a / b), Q16_16_RESOLUTION);
+    EXPECT_DOUBLE_EQ(1.5, static_cast<double>(-b));
+    EXPECT_TRUE(b < a);
+    EXPECT_TRUE(a >= a);
+    EXPECT_TRUE(Q16_16(2) == Q16_16(2.0));
+  }
+
+  // 表現範囲を超える演算は飽和させる
+  TEST(FixedPointTest, saturate)
+  {
+    Q16_16 big(30000);
+    EXPECT_EQ(Q16_16::RAW_MAX, (big + big).getRaw());
+    EXPECT_EQ(Q16_16::RAW_MIN, (-big - big).getRaw());
+    EXPECT_EQ(Q16_16::RAW_MAX, (big * Q16_16(2)).getRaw());
+    EXPECT_EQ(Q16_16::RAW_MAX, (Q16_16(1) / Q16_16(0)).getRaw());
+    EXPECT_EQ(Q16_16::RAW_MIN, (Q16_16(-1) / Q16_16(0)).getRaw());
+  }
+
+  // ライントレースを模した入力列で、doubleと固定小数点数のPIDの操作量が許容誤差内で一致する
+  TEST(FixedPointTest, pidEquivalence)
+  {
+    double kp = 0.09, ki = 0.08, kd = 0.05;
+    double targetValue = 45;
+    double timeConstant = 0.001;
+    Pid doublePid(kp, ki, kd, targetValue, 5.0, timeConstant);
+    FixedPointPid fixedPid(kp, ki, kd, targetValue, 5.0, timeConstant);
+    doublePid.setOutputLimit(-100, 100);
+    fixedPid.setOutputLimit(-100, 100);
+
+    double maxError = 0.0;
+    for(int n = 0; n < 2000; n++) {
+      // 白と黒の間を行き来する輝度
+      int brightness = 45 + static_cast<int>(40.0 * sin(n * 0.05)) + (n % 7) - 3;
+      double expected = doublePid.calculatePid(brightness, 0.01);
+      double actual = static_cast<double>(fixedPid.calculatePid(brightness, 0.01));
+      maxError = fmax(maxError, fabs(expected - actual));
+    }
+    // 旋回値(PWM値)として無視できる誤差に収まる
+    EXPECT_GT(0.05, maxError);
+  }
+
+  // 新しいモードを有効にした場合も許容誤差内で一致する
+  TEST(FixedPointTest, pidEquivalenceWithFilter)
+  {
+    double kp = 0.9, ki = 0.1, kd = 0.1;
+    Pid doublePid(kp, ki, kd, 45);
+    FixedPointPid fixedPid(kp, ki, kd, 45);
+    doublePid.setIntegralLimit(50);
+    fixedPid.setIntegralLimit(50);
+    doublePid.setOutputLimit(-100, 100, 0.5);
+    fixedPid.setOutputLimit(-100, 100, 0.5);
+    doublePid.setDerivativeFilter(0.02);
+    fixedPid.setDerivativeFilter(0.02);
+
+    double maxError = 0.0;
+    for(int n = 0; n < 2000; n++) {
+      int brightness = (n / 100) % 2 == 0 ? 5 : 90;  // 急な変化を含む入力
+      double expected = doublePid.calculatePid(brightness, 0.01);
+      double actual = static_cast<double>(fixedPid.calculatePid(brightness, 0.01));
+      maxError = fmax(maxError, fabs(expected - actual));
+    }
+    // 周期0.01[s]の量子化誤差が急な変化のD制御で拡大されるため、操作量の範囲の0.1%を許容する
+    EXPECT_GT(0.2, maxError);
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,159 @@
+/**
+ * @file   GainSchedulerTest.cpp
+ * @brief  GainSchedulerクラスのテスト
+ * @author KatLab
+ */
+
+#include "GainScheduler.h"
+#include "Controller.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(GainSchedulerTest, calcCurvature)
+  {
+    // 左右の速度が等しい場合は直線
+    EXPECT_DOUBLE_EQ(0.0, GainScheduler::calcCurvature(200.0, 200.0));
+    // 平均速度が0の場合は0
+    EXPECT_DOUBLE_EQ(0.0, GainScheduler::calcCurvature(100.0, -100.0));
+    // 右が速い場合は左に曲がる(正)、半径R=TREAD*(右+左)/(2*(右-左))
+    double expected = 1.0 / (TREAD * (300.0 + 100.0) / (2.0 * (300.0 - 100.0)));
+    EXPECT_NEAR(expected, GainScheduler::calcCurvature(300.0, 100.0), 1e-9);
+    EXPECT_NEAR(-expected, GainScheduler::calcCurvature(100.0, 300.0), 1e-9);
+  }
+
+  TEST(GainSchedulerTest, interpolate)
+  {
+    PidGain straightGain(0.1, 0.0, 0.2);
+    PidGain curveGain(0.9, 0.4, 0.6);
+    PidGain actual = GainScheduler::interpolate(straightGain, curveGain, 0.5);
+    EXPECT_DOUBLE_EQ(0.5, actual.kp);
+    EXPECT_DOUBLE_EQ(0.2, actual.ki);
+    EXPECT_DOUBLE_EQ(0.4, actual.kd);
+    // 重みは0~1に収める
+    actual = GainScheduler::interpolate(straightGain, curveGain, 2.0);
+    EXPECT_DOUBLE_EQ(curveGain.kp, actual.kp);
+    actual = GainScheduler::interpolate(straightGain, curveGain, -1.0);
+    EXPECT_DOUBLE_EQ(straightGain.kp, actual.kp);
+  }
+
+  // 直進中は直線でのゲイン、旋回中はカーブでのゲインに近づく
+  TEST(GainSchedulerTest, calculateGain)
+  {
+    Timer timer;
+    PidGain straightGain(0.1, 0.0, 0.2);
+    PidGain curveGain(0.9, 0.4, 0.6);
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    // 速度が1つだけの場合は曲率だけで補間する
+    GainScheduler scheduler({ GainScheduleLevel(200.0, straightGain, curveGain) });
+
+    // 直進
+    PidGain actual = scheduler.calculateGain();
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(60.0);
+      timer.sleep(10);
+      actual = scheduler.calculateGain();
+    }
+    EXPECT_NEAR(0.0, scheduler.getCurvature(), 1e-4);
+    EXPECT_NEAR(straightGain.kp, actual.kp, 0.01);
+
+    // 急な左旋回(右車輪だけを回す)
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(0.0);
+      timer.sleep(10);
+      actual = scheduler.calculateGain();
+    }
+    Controller::stopMotor();
+    EXPECT_LT(GainScheduler::CURVE_CURVATURE, scheduler.getCurvature());
+    EXPECT_NEAR(1.0, scheduler.getWeight(), 0.01);
+    EXPECT_NEAR(curveGain.kp, actual.kp, 0.01);
+  }
+
+  // 低速時は重みを更新しない
+  TEST(GainSchedulerTest, holdWeightAtLowSpeed)
+  {
+    Timer timer;
+    PidGain straightGain(0.1, 0.0, 0.2);
+    PidGain curveGain(0.9, 0.4, 0.6);
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    GainScheduler scheduler({ GainScheduleLevel(200.0, straightGain, curveGain) });
+    for(int i = 0; i < 20; i++) {
+      timer.sleep(10);
+      scheduler.calculateGain();
+    }
+    EXPECT_DOUBLE_EQ(0.0, scheduler.getWeight());
+  }
+
+  // 走行速度を挟む2つの速度のPIDゲインを、走行速度と曲率で双線形補間する
+  TEST(GainSchedulerTest, interpolateSpeed)
+  {
+    Timer timer;
+    PidGain slowStraightGain(0.1, 0.0, 0.2);
+    PidGain slowCurveGain(0.9, 0.4, 0.6);
+    PidGain fastStraightGain(0.3, 0.2, 0.4);
+    PidGain fastCurveGain(0.5, 0.2, 0.4);
+    double fastSpeed = 10000.0;
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    // 速度の順は問わない
+    GainScheduler scheduler({ GainScheduleLevel(fastSpeed, fastStraightGain, fastCurveGain),
+                              GainScheduleLevel(0.0, slowStraightGain, slowCurveGain) });
+
+    // 直進
+    PidGain actual = scheduler.calculateGain();
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(60.0);
+      timer.sleep(10);
+      actual = scheduler.calculateGain();
+    }
+    double speedWeight = scheduler.getSpeed() / fastSpeed;
+    ASSERT_LT(0.0, speedWeight);
+    ASSERT_GT(1.0, speedWeight);
+    EXPECT_NEAR(0.0, scheduler.getWeight(), 0.01);
+    EXPECT_NEAR(0.1 + (0.3 - 0.1) * speedWeight, actual.kp, 0.01);
+    EXPECT_NEAR(0.0 + (0.2 - 0.0) * speedWeight, actual.ki, 0.01);
+
+    // 急な左旋回では、それぞれの速度のカーブでのPIDゲインを速度で補間する
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(0.0);
+      timer.sleep(10);
+      actual = scheduler.calculateGain();
+    }
+    Controller::stopMotor();
+    speedWeight = scheduler.getSpeed() / fastSpeed;
+    EXPECT_NEAR(1.0, scheduler.getWeight(), 0.01);
+    EXPECT_NEAR(0.9 + (0.5 - 0.9) * speedWeight, actual.kp, 0.01);
+  }
+
+  // 走行速度が速度の範囲外の場合は端の速度のPIDゲインを使う
+  TEST(GainSchedulerTest, clampSpeed)
+  {
+    Timer timer;
+    PidGain slowGain(0.1, 0.0, 0.2);
+    PidGain fastGain(0.3, 0.2, 0.4);
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    GainScheduler scheduler({ GainScheduleLevel(1.0, slowGain, slowGain),
+                              GainScheduleLevel(2.0, fastGain, fastGain) });
+    PidGain actual = scheduler.calculateGain();
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(60.0);
+      timer.sleep(10);
+      actual = scheduler.calculateGain();
+    }
+    Controller::stopMotor();
+    EXPECT_LT(2.0, scheduler.getSpeed());
+    EXPECT_DOUBLE_EQ(fastGain.kp, actual.kp);
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,94 @@
+/**
+ * @file   HeadingRotationTest.cpp
+ * @brief  HeadingRotationクラスのテスト
+ * @author KatLab
+ */
+
+#include "HeadingRotation.h"
+#include <gtest/gtest.h>
+#include <cmath>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 反時計回りに回頭するテスト
+  TEST(HeadingRotationTest, runAnticlockwise)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    HeadingRotation hr(90.0, 60.0);
+
+    hr.run();
+
+    // 目標の向きまで回頭し、行き過ぎは小さい
+    double theta = Odometry::getPose().theta * 180.0 / M_PI;
+    EXPECT_LE(90.0, theta);
+    EXPECT_GT(110.0, theta);
+  }
+
+  // 時計回りに回頭するテスト
+  TEST(HeadingRotationTest, runClockwise)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    HeadingRotation hr(-90.0, 60.0);
+
+    hr.run();
+
+    double theta = Odometry::getPose().theta * 180.0 / M_PI;
+    EXPECT_GE(-90.0, theta);
+    EXPECT_LT(-110.0, theta);
+  }
+
+  // 回転角が小さくなる方向に回頭するテスト
+  TEST(HeadingRotationTest, runShorterDirection)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    Pose pose = { 0.0, 0.0, 150.0 * M_PI / 180.0 };
+    Odometry::setPose(pose);
+    // 150[deg]から-150[deg]へは反時計回りに60[deg]回頭する
+    HeadingRotation hr(-150.0, 60.0);
+
+    hr.run();
+
+    double theta = Odometry::getPose().theta * 180.0 / M_PI;
+    EXPECT_LE(-150.0, theta);
+    EXPECT_GT(-130.0, theta);
+  }
+
+  // すでに目標の向きを向いている場合は回頭しないテスト
+  TEST(HeadingRotationTest, runAlreadyHeading)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    int initialRightCount = Measurer::getRightCount();
+    int initialLeftCount = Measurer::getLeftCount();
+    HeadingRotation hr(0.5, 60.0);
+
+    hr.run();
+
+    EXPECT_EQ(initialRightCount, Measurer::getRightCount());
+    EXPECT_EQ(initialLeftCount, Measurer::getLeftCount());
+  }
+
+  // 目標速度が0以下の場合はwarningを出して回頭しないテスト
+  TEST(HeadingRotationTest, runZeroSpeed)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    HeadingRotation hr(90.0, 0.0);
+
+    testing::internal::CaptureStdout();
+    hr.run();
+    string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(string::npos, output.find("Warning"));
+    EXPECT_NEAR(0.0, Odometry::getPose().theta, 0.001);
+  }
+}  // namespace etrobocon2023_test
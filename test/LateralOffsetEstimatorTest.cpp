@@ -0,0 +1,88 @@
+/**
+ * @file   LateralOffsetEstimatorTest.cpp
+ * @brief  LateralOffsetEstimatorクラスのテスト
+ * @author KatLab
+ */
+
+#include "LateralOffsetEstimator.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(LateralOffsetEstimatorTest, build)
+  {
+    // 横ずれが大きいほど暗くなる(黒側へずれる)サンプル
+    LateralOffsetEstimator::clear();
+    LateralOffsetEstimator::clearSamples();
+    LateralOffsetEstimator::addSample(80, -10.0);
+    LateralOffsetEstimator::addSample(60, 0.0);
+    LateralOffsetEstimator::addSample(60, 2.0);
+    LateralOffsetEstimator::addSample(20, 10.0);
+    ASSERT_TRUE(LateralOffsetEstimator::build());
+    ASSERT_TRUE(LateralOffsetEstimator::isEnabled());
+
+    // 白に近いほど横ずれが大きくなる向きにそろえる
+    EXPECT_DOUBLE_EQ(-10.0, LateralOffsetEstimator::estimate(20));
+    EXPECT_DOUBLE_EQ(-1.0, LateralOffsetEstimator::estimate(60));  // 同じ輝度は平均
+    EXPECT_DOUBLE_EQ(10.0, LateralOffsetEstimator::estimate(80));
+    // サンプルのない輝度は線形補間し、範囲外は端の値
+    EXPECT_DOUBLE_EQ(-5.5, LateralOffsetEstimator::estimate(40));
+    EXPECT_DOUBLE_EQ(4.5, LateralOffsetEstimator::estimate(70));
+    EXPECT_DOUBLE_EQ(-10.0, LateralOffsetEstimator::estimate(0));
+    EXPECT_DOUBLE_EQ(10.0, LateralOffsetEstimator::estimate(100));
+    EXPECT_DOUBLE_EQ(-3.25, LateralOffsetEstimator::estimate(50.0));
+    LateralOffsetEstimator::clear();
+  }
+
+  TEST(LateralOffsetEstimatorTest, buildMonotonic)
+  {
+    LateralOffsetEstimator::clearSamples();
+    LateralOffsetEstimator::addSample(10, -20.0);
+    LateralOffsetEstimator::addSample(40, 5.0);
+    LateralOffsetEstimator::addSample(50, 0.0);  // ノイズで逆転したサンプル
+    LateralOffsetEstimator::addSample(90, 20.0);
+    ASSERT_TRUE(LateralOffsetEstimator::build());
+
+    // 単調増加になるよう補正する
+    for(int i = 1; i <= 100; i++) {
+      EXPECT_LE(LateralOffsetEstimator::estimate(i - 1), LateralOffsetEstimator::estimate(i));
+    }
+    EXPECT_DOUBLE_EQ(5.0, LateralOffsetEstimator::estimate(50));
+    LateralOffsetEstimator::clear();
+  }
+
+  TEST(LateralOffsetEstimatorTest, notBuild)
+  {
+    LateralOffsetEstimator::clear();
+    LateralOffsetEstimator::clearSamples();
+    LateralOffsetEstimator::addSample(50, 1.0);
+    LateralOffsetEstimator::addSample(50, 3.0);
+    // 輝度が1段階しかない場合は作れない
+    EXPECT_FALSE(LateralOffsetEstimator::build());
+    EXPECT_FALSE(LateralOffsetEstimator::isEnabled());
+    EXPECT_DOUBLE_EQ(0.0, LateralOffsetEstimator::estimate(50));
+    EXPECT_FALSE(LateralOffsetEstimator::save("lateral_offset_test.csv"));
+  }
+
+  TEST(LateralOffsetEstimatorTest, saveAndLoad)
+  {
+    const char* filePath = "lateral_offset_test.csv";
+    LateralOffsetEstimator::clearSamples();
+    LateralOffsetEstimator::addSample(10, -20.0);
+    LateralOffsetEstimator::addSample(90, 20.0);
+    ASSERT_TRUE(LateralOffsetEstimator::build());
+    ASSERT_TRUE(LateralOffsetEstimator::save(filePath));
+
+    LateralOffsetEstimator::clear();
+    ASSERT_TRUE(LateralOffsetEstimator::load(filePath));
+    remove(filePath);
+    EXPECT_NEAR(0.0, LateralOffsetEstimator::estimate(50), 1e-6);
+    EXPECT_NEAR(-20.0, LateralOffsetEstimator::estimate(10), 1e-6);
+
+    LateralOffsetEstimator::clear();
+    EXPECT_FALSE(LateralOffsetEstimator::load("not_exist_lateral_offset.csv"));
+    EXPECT_FALSE(LateralOffsetEstimator::isEnabled());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,102 @@
+/**
+ * @file   LineLossDetectorTest.cpp
+ * @brief  LineLossDetectorクラスのテスト
+ * @author KatLab
+ */
+
+#include "LineLossDetector.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  static constexpr uint64_t CYCLE = 10000;  // 制御周期[us]
+
+  TEST(LineLossDetectorTest, onLine)
+  {
+    LineLossDetector detector(true);
+    // 目標輝度の前後を行き来している間は見失わない
+    for(int i = 0; i < 100; i++) {
+      double deviation = i % 2 == 0 ? 15.0 : -15.0;
+      EXPECT_FALSE(detector.update(deviation, true, 0.0, i * CYCLE));
+    }
+    EXPECT_EQ(1, detector.getOffLineSide());  // 最後の偏差は白側
+  }
+
+  TEST(LineLossDetectorTest, lostBySaturation)
+  {
+    LineLossDetector detector(true);
+    uint64_t time = 0;
+    // 白側に外れ、旋回値が飽和し続ける
+    int cycleCount = 0;
+    while(!detector.update(-30.0, true, 0.0, time)) {
+      time += CYCLE;
+      cycleCount++;
+      ASSERT_GT(100, cycleCount);
+    }
+    EXPECT_EQ(LineLossDetector::LOSS_DURATION / CYCLE, cycleCount);
+    EXPECT_EQ(1, detector.getOffLineSide());
+    EXPECT_EQ(LineLossDetector::LOSS_DURATION, detector.getOffLineDuration(time));
+
+    // 見失った後はリセットするまで見失ったままになる
+    EXPECT_TRUE(detector.update(0.0, false, 0.0, time + CYCLE));
+    detector.reset();
+    EXPECT_FALSE(detector.update(0.0, false, 0.0, time + CYCLE));
+  }
+
+  TEST(LineLossDetectorTest, lostByHeadingChange)
+  {
+    LineLossDetector detector(false);
+    uint64_t time = 0;
+    double theta = 0.0;
+    // 右エッジで黒側に外れ、旋回値は飽和しないまま反時計回り(ラインから離れる向き)に向きが
+    // 変わり続ける(-π~πをまたいでも累計する)
+    theta = 3.0;
+    int cycleCount = 0;
+    while(!detector.update(30.0, false, Odometry::normalizeAngle(theta), time)) {
+      time += CYCLE;
+      theta += 0.05;
+      cycleCount++;
+      ASSERT_GT(100, cycleCount);
+    }
+    EXPECT_EQ(-1, detector.getOffLineSide());
+    EXPECT_LE(LineLossDetector::LOSS_HEADING_CHANGE, detector.getHeadingChange());
+  }
+
+  TEST(LineLossDetectorTest, notLostByCorrectiveTurn)
+  {
+    LineLossDetector detector(true);
+    uint64_t time = 0;
+    double theta = 0.0;
+    // 左エッジで黒側に外れ、反時計回り(ラインへ戻る向き)に向きが変わり続けても見失わない
+    for(int i = 0; i < 100; i++) {
+      EXPECT_FALSE(detector.update(30.0, false, Odometry::normalizeAngle(theta), time));
+      time += CYCLE;
+      theta += 0.05;
+    }
+    EXPECT_DOUBLE_EQ(0.0, detector.getHeadingChange());
+
+    // 離れる向きに変わった量は、ラインへ戻る向きの旋回で打ち消される
+    LineLossDetector swingingDetector(true);
+    theta = 0.0;
+    for(int i = 0; i < 100; i++) {
+      EXPECT_FALSE(swingingDetector.update(30.0, false, theta, i * CYCLE));
+      theta += (i / 10) % 2 == 0 ? -0.05 : 0.05;
+    }
+  }
+
+  TEST(LineLossDetectorTest, notLostWithoutTurning)
+  {
+    LineLossDetector detector(true);
+    // 外れていても、旋回値が飽和せず向きも変わらなければ見失ったとはみなさない
+    for(int i = 0; i < 100; i++) {
+      EXPECT_FALSE(detector.update(-30.0, false, 0.0, i * CYCLE));
+    }
+    // 外れる側が入れ替わると継続時間は数え直す
+    LineLossDetector switchingDetector(true);
+    for(int i = 0; i < 100; i++) {
+      double deviation = (i / 10) % 2 == 0 ? -30.0 : 30.0;
+      EXPECT_FALSE(switchingDetector.update(deviation, true, 0.0, i * CYCLE));
+    }
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,56 @@
+/**
+ * @file   LineRecoveryTest.cpp
+ * @brief  LineRecoveryクラスのテスト
+ * @author KatLab
+ */
+
+#include "LineRecovery.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(LineRecoveryTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    srand(0);
+    LineRecovery lr(true, 60.0, 40, 45);
+
+    lr.run();
+
+    // ダミーの輝度は毎回ばらつくので、すぐに目標輝度をまたいで見つかる
+    EXPECT_TRUE(lr.isFound());
+    EXPECT_GE(60.0, fabs(lr.getFoundAngle()));
+  }
+
+  TEST(LineRecoveryTest, notFound)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    // 目標輝度が輝度の範囲外の場合は、左右に探しても見つからない
+    LineRecovery lr(false, 30.0, 40, 200);
+
+    lr.run();
+
+    EXPECT_FALSE(lr.isFound());
+    EXPECT_EQ(0.0, Controller::getRightPwm());
+    EXPECT_EQ(0.0, Controller::getLeftPwm());
+  }
+
+  TEST(LineRecoveryTest, runInvalidParameter)
+  {
+    LineRecovery zeroPwm(true, 30.0, 0, 45);
+    LineRecovery zeroAngle(true, 0.0, 40, 45);
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    zeroPwm.run();
+    zeroAngle.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos, output.find("The pwm value passed to LineRecovery is 0"));
+    EXPECT_NE(string::npos, output.find("The sweepAngle value passed to LineRecovery is 0.00"));
+    EXPECT_FALSE(zeroPwm.isFound());
+    EXPECT_FALSE(zeroAngle.isFound());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,127 @@
+/**
+ * @file   LoopProfilerTest.cpp
+ * @brief  LoopProfilerクラスのテスト
+ * @author KatLab
+ */
+
+#include "LoopProfiler.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(LoopProfilerTest, measureCycles)
+  {
+    Timer timer;
+    LoopProfiler::reset();
+
+    // 10ミリ秒周期の制御ループを5周期実行する
+    for(int i = 0; i < 5; i++) {
+      LoopProfiler::beginCycle();
+      LoopProfiler::endCycle();
+      timer.sleep(10);
+    }
+    LoopProfiler::endLoop();
+
+    EXPECT_EQ(5, LoopProfiler::getCycleCount());
+    EXPECT_EQ(4, LoopProfiler::getPeriodCount());
+    // ダミーのクロックはnow()の呼び出しごとに1マイクロ秒進む
+    EXPECT_LE(10000u, LoopProfiler::getMinPeriod());
+    EXPECT_GT(10010u, LoopProfiler::getMaxPeriod());
+    EXPECT_LE(static_cast<double>(LoopProfiler::getMinPeriod()), LoopProfiler::getMeanPeriod());
+    EXPECT_GE(static_cast<double>(LoopProfiler::getMaxPeriod()), LoopProfiler::getMeanPeriod());
+    EXPECT_EQ(LoopProfiler::getMaxPeriod(), LoopProfiler::getP99Period());
+    EXPECT_GT(10u, LoopProfiler::getMaxComputeTime());
+    EXPECT_EQ(0, LoopProfiler::getOverrunCount());
+  }
+
+  TEST(LoopProfilerTest, countOverrun)
+  {
+    Timer timer;
+    LoopProfiler::reset();
+
+    // デッドラインを超える周期を1回含める
+    LoopProfiler::beginCycle();
+    timer.sleep(10);
+    LoopProfiler::beginCycle();
+    timer.sleep(20);
+    LoopProfiler::beginCycle();
+    timer.sleep(10);
+    LoopProfiler::beginCycle();
+    LoopProfiler::endLoop();
+
+    EXPECT_EQ(3, LoopProfiler::getPeriodCount());
+    EXPECT_EQ(1, LoopProfiler::getOverrunCount());
+    EXPECT_LE(20000u, LoopProfiler::getMaxPeriod());
+    // 3周期中の99パーセンタイル値は最大値になる
+    EXPECT_EQ(LoopProfiler::getMaxPeriod(), LoopProfiler::getP99Period());
+  }
+
+  TEST(LoopProfilerTest, excludeGapBetweenLoops)
+  {
+    Timer timer;
+    LoopProfiler::reset();
+
+    // 制御ループ間の時間は周期に含めない
+    LoopProfiler::beginCycle();
+    timer.sleep(10);
+    LoopProfiler::beginCycle();
+    LoopProfiler::endLoop();
+    timer.sleep(100);
+    LoopProfiler::beginCycle();
+    timer.sleep(10);
+    LoopProfiler::beginCycle();
+    LoopProfiler::endLoop();
+
+    EXPECT_EQ(4, LoopProfiler::getCycleCount());
+    EXPECT_EQ(2, LoopProfiler::getPeriodCount());
+    EXPECT_EQ(0, LoopProfiler::getOverrunCount());
+  }
+
+  TEST(LoopProfilerTest, p99Period)
+  {
+    Timer timer;
+    LoopProfiler::reset();
+
+    // 200周期のうち2周期だけ長い周期を含めると、99パーセンタイル値は通常の周期の階級に収まる
+    LoopProfiler::beginCycle();
+    for(int i = 0; i < 200; i++) {
+      timer.sleep(i < 2 ? 30 : 10);
+      LoopProfiler::beginCycle();
+    }
+    LoopProfiler::endLoop();
+
+    EXPECT_EQ(200, LoopProfiler::getPeriodCount());
+    EXPECT_EQ(2, LoopProfiler::getOverrunCount());
+    EXPECT_EQ(10200u, LoopProfiler::getP99Period());
+  }
+
+  TEST(LoopProfilerTest, logSummaryWithoutCycle)
+  {
+    LoopProfiler::reset();
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    LoopProfiler::logSummary();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // 制御周期を計測していない場合は何も出力しない
+    EXPECT_EQ("", output);
+  }
+
+  TEST(LoopProfilerTest, logSummary)
+  {
+    Timer timer;
+    LoopProfiler::reset();
+    LoopProfiler::beginCycle();
+    timer.sleep(10);
+    LoopProfiler::beginCycle();
+    LoopProfiler::endLoop();
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    LoopProfiler::logSummary();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos, output.find("Loop (cycles: 2,"));
+    EXPECT_NE(string::npos, output.find("overruns: 0)"));
+  }
+}  // namespace etrobocon2023_test
@@ -5,6 +5,7 @@
  */
 
 #include "Measurer.h"
+#include "Controller.h"
 #include <gtest/gtest.h>
 
 // rgb_raw_tの比較用関数
@@ -80,4 +81,20 @@ namespace etrobocon2023_test {
 
     EXPECT_EQ(expected, actual);
   }
+
+  TEST(MeasurerTest, getTotalCountAfterResetCount)
+  {
+    Controller::setRightMotorPwm(100);
+    Controller::setLeftMotorPwm(-100);
+    int expectedRight = Measurer::getRightTotalCount();
+    int expectedLeft = Measurer::getLeftTotalCount();
+
+    // 角位置を初期化しても起動時からの角位置は変わらない
+    Measurer::resetCount();
+    EXPECT_EQ(0, Measurer::getRightCount());
+    EXPECT_EQ(0, Measurer::getLeftCount());
+    EXPECT_EQ(expectedRight, Measurer::getRightTotalCount());
+    EXPECT_EQ(expectedLeft, Measurer::getLeftTotalCount());
+    Controller::stopMotor();
+  }
 }  // namespace etrobocon2023_test
\ No newline at end of file
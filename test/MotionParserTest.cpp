@@ -61,6 +61,447 @@ namespace etrobocon2023_test {
     EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
   }
 
+  TEST(MotionParserTest, createPoseMotions)
+  {
+    const char* filePath = "../test/test_data/PoseCommandParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/PoseCommandParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    HeadingRotation* hr = new HeadingRotation(-90, 60);
+    expectedList.push_back(hr);
+    WaypointDriving* wp = new WaypointDriving(300.5, -200, 150, 60);
+    expectedList.push_back(wp);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+  }
+
+  TEST(MotionParserTest, createGainScheduledMotions)
+  {
+    const char* filePath = "../test/test_data/GainScheduleParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成時のwarningを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+    string parseOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // logRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/GainScheduleParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    DistanceLineTracing* dl = new DistanceLineTracing(500, 300, targetBrightness + 5,
+                                                      PidGain(0.09, 0.08, 0.05), isLeftEdge);
+    dl->addGainScheduleLevel(200, PidGain(0.09, 0.08, 0.05), PidGain(0.91, 0.1, 0.1));
+    dl->addGainScheduleLevel(400, PidGain(0.07, 0.06, 0.04), PidGain(0.6, 0.08, 0.08));
+    expectedList.push_back(dl);
+    ColorLineTracing* cl = new ColorLineTracing(COLOR::BLUE, 250, targetBrightness + 0,
+                                                PidGain(0.1, 0.05, 0.05), isLeftEdge);
+    cl->addGainScheduleLevel(250, PidGain(0.1, 0.05, 0.05), PidGain(0.8, 0.1, 0.08));
+    expectedList.push_back(cl);
+    // GSコマンドが続かない行はゲインスケジュールを使わない
+    DistanceLineTracing* dl2 = new DistanceLineTracing(100, 200, targetBrightness + 0,
+                                                       PidGain(0.2, 0.1, 0.1), isLeftEdge);
+    expectedList.push_back(dl2);
+    // ライントレース動作に続かないGSコマンドはwarningを出して無視する
+    DistanceStraight* ds = new DistanceStraight(100, 200);
+    expectedList.push_back(ds);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos, actualOutput.find("speed: 200.00, straightGain: (0.09,0.08,0.05), "
+                                              "curveGain: (0.91,0.10,0.10)"));
+    EXPECT_NE(string::npos, actualOutput.find("speed: 400.00, straightGain: (0.07,0.06,0.04), "
+                                              "curveGain: (0.60,0.08,0.08)"));
+    EXPECT_NE(string::npos, actualOutput.find("curveGain: (0.80,0.10,0.08)"));
+    EXPECT_NE(string::npos, parseOutput.find("GS must follow a line tracing command"));
+  }
+
+  TEST(MotionParserTest, createSpeedAdaptiveMotions)
+  {
+    const char* filePath = "../test/test_data/AdaptiveSpeedParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = false;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/AdaptiveSpeedParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    DistanceLineTracing* dv = new DistanceLineTracing(1000, 400, targetBrightness + 5,
+                                                      PidGain(0.09, 0.08, 0.05), isLeftEdge);
+    dv->setSpeedRange(150, 400);
+    expectedList.push_back(dv);
+    ColorLineTracing* cv = new ColorLineTracing(COLOR::RED, 300, targetBrightness + 0,
+                                                PidGain(0.1, 0.05, 0.05), isLeftEdge);
+    cv->setSpeedRange(120, 300);
+    cv->addGainScheduleLevel(300, PidGain(0.1, 0.05, 0.05), PidGain(0.8, 0.1, 0.08));
+    expectedList.push_back(cv);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos, actualOutput.find("minSpeed: 150.00, maxSpeed: 400.00"));
+    EXPECT_NE(string::npos, actualOutput.find("minSpeed: 120.00, maxSpeed: 300.00"));
+  }
+
+  TEST(MotionParserTest, createAutoTuningMotions)
+  {
+    const char* filePath = "../test/test_data/AutoTuningParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // 以前の走行で調整したPIDゲインが保存されているものとする
+    PidGainStore::clear();
+    PidGainStore::setGain("trace", PidGain(0.5, 0.2, 0.1));
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+    PidGainStore::clear();
+
+    // test_data/AutoTuningParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    PidAutoTuning* at1 = new PidAutoTuning(500, 200, targetBrightness + 0, 30,
+                                           TUNING_RULE::TYREUS_LUYBEN, "trace", isLeftEdge);
+    expectedList.push_back(at1);
+    PidAutoTuning* at2 = new PidAutoTuning(400, 150, targetBrightness + 5, 25,
+                                           TUNING_RULE::ZIEGLER_NICHOLS, "", isLeftEdge);
+    expectedList.push_back(at2);
+    DistanceLineTracing* dl = new DistanceLineTracing(300, 200, targetBrightness + 0,
+                                                      PidGain(0.5, 0.2, 0.1), isLeftEdge);
+    expectedList.push_back(dl);
+    DistanceLineTracing* dv = new DistanceLineTracing(400, 300, targetBrightness + 0,
+                                                      PidGain(0.5, 0.2, 0.1), isLeftEdge);
+    dv->setSpeedRange(150, 300);
+    expectedList.push_back(dv);
+    // 保存されていない名前のPIDゲインを指定した行はWarningを出して生成しない
+    string expectedOutput = "\x1b[36m";  // 文字色をシアンに
+    expectedOutput += "Warning: ../test/test_data/AutoTuningParserTestData.csv:4: ";
+    expectedOutput += "tuned gain '@unknown' is not found";
+    expectedOutput += "\n\x1b[39m";  // 文字色をデフォルトに戻す
+    expectedOutput += "\x1b[36m";     // 文字色をシアンに
+    expectedOutput += "Warning: ../test/test_data/AutoTuningParserTestData.csv:6: ";
+    expectedOutput += "tuned gain '@unknown' is not found";
+    expectedOutput += "\n\x1b[39m";  // 文字色をデフォルトに戻す
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    expectedOutput += testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos, actualOutput.find("rule: TL, gainName: trace"));
+    EXPECT_NE(string::npos, actualOutput.find("rule: ZN, gainName: none"));
+  }
+
+  TEST(MotionParserTest, createLateralOffsetMotions)
+  {
+    const char* filePath = "../test/test_data/LateralOffsetParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/LateralOffsetParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    BrightnessSweep* bs = new BrightnessSweep(30, 40);
+    expectedList.push_back(bs);
+    DistanceLineTracing* dl = new DistanceLineTracing(500, 250, targetBrightness + 0,
+                                                      PidGain(2.0, 0.5, 0.1), isLeftEdge);
+    dl->setLateralOffsetInput();
+    expectedList.push_back(dl);
+    ColorLineTracing* cl = new ColorLineTracing(COLOR::BLUE, 200, targetBrightness + 5,
+                                                PidGain(1.5, 0.4, 0.1), isLeftEdge);
+    cl->addGainScheduleLevel(200, PidGain(1.5, 0.4, 0.1), PidGain(2.5, 0.5, 0.2));
+    cl->setLateralOffsetInput();
+    expectedList.push_back(cl);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos, actualOutput.find("Run BrightnessSweep (sweepAngle: 30.00, pwm: 40)"));
+    EXPECT_NE(string::npos, actualOutput.find("Lateral offset input"));
+  }
+
+  TEST(MotionParserTest, createLinearizedMotions)
+  {
+    const char* filePath = "../test/test_data/LinearizedParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/LinearizedParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    DistanceLineTracing* dn = new DistanceLineTracing(300, 200, targetBrightness + 0,
+                                                      PidGain(0.2, 0.1, 0.1), isLeftEdge);
+    dn->setLinearizedInput();
+    expectedList.push_back(dn);
+    ColorLineTracing* cn = new ColorLineTracing(COLOR::RED, 250, targetBrightness + 5,
+                                                PidGain(0.3, 0.1, 0.1), isLeftEdge);
+    cn->setLinearizedInput();
+    expectedList.push_back(cn);
+    // DLは変換表があっても輝度のまま入力する
+    DistanceLineTracing* dl = new DistanceLineTracing(100, 200, targetBrightness + 0,
+                                                      PidGain(0.2, 0.1, 0.1), isLeftEdge);
+    expectedList.push_back(dl);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos, actualOutput.find("Linearized brightness input"));
+  }
+
+  TEST(MotionParserTest, createObstacleApproachMotions)
+  {
+    const char* filePath = "../test/test_data/ObstacleApproachParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    string expectedOutput = "Run ObstacleApproach (targetSpeed: 200.00, stopDistance: 50, "
+                            "slowDistance: 150, maxDistance: 1000.00)\n";
+
+    EXPECT_EQ(1, actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+  }
+
+  TEST(MotionParserTest, createFeedforwardCalibrationMotions)
+  {
+    const char* filePath = "../test/test_data/FeedforwardParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成とlogRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    string expectedOutput = "Run FeedforwardCalibration (minPwm: 30, maxPwm: 70, stepPwm: 20, "
+                            "stepTime: 1000)\n";
+
+    EXPECT_EQ(1, actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+  }
+
+  TEST(MotionParserTest, createWatchdogMotions)
+  {
+    const char* filePath = "../test/test_data/WatchdogParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // WDコマンドは直前の動作に制限を設定し、動作の直後でない場合はwarningを出して無視する
+    ASSERT_EQ(3, actualList.size());
+    EXPECT_EQ(8000, actualList[0]->getTimeLimit());
+    EXPECT_DOUBLE_EQ(1200.0, actualList[0]->getDistanceLimit());
+    EXPECT_EQ(WATCHDOG_REACTION::ABORT, actualList[0]->getWatchdogReaction());
+    EXPECT_EQ(3000, actualList[1]->getTimeLimit());
+    EXPECT_DOUBLE_EQ(0.0, actualList[1]->getDistanceLimit());
+    EXPECT_EQ(WATCHDOG_REACTION::CONTINUE, actualList[1]->getWatchdogReaction());
+    EXPECT_EQ(0, actualList[2]->getTimeLimit());
+    EXPECT_DOUBLE_EQ(0.0, actualList[2]->getDistanceLimit());
+    EXPECT_NE(string::npos, actualOutput.find("WD must follow a motion command"));
+  }
+
+  TEST(MotionParserTest, createLineRecoveryMotions)
+  {
+    const char* filePath = "../test/test_data/LineRecoveryParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    // actualListの生成時のwarningを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+    string parseOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // logRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/LineRecoveryParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    DistanceLineTracing* dl = new DistanceLineTracing(500, 300, targetBrightness + 5,
+                                                      PidGain(0.09, 0.08, 0.05), isLeftEdge);
+    dl->setLineRecovery(2, 60.0);
+    expectedList.push_back(dl);
+    ColorLineTracing* cl = new ColorLineTracing(COLOR::BLUE, 250, targetBrightness + 0,
+                                                PidGain(0.1, 0.05, 0.05), isLeftEdge);
+    cl->addGainScheduleLevel(250, PidGain(0.1, 0.05, 0.05), PidGain(0.8, 0.1, 0.08));
+    cl->setLineRecovery(1, 45.0);
+    expectedList.push_back(cl);
+    // LRコマンドが続かない行は探し直さない
+    DistanceLineTracing* dl2 = new DistanceLineTracing(100, 200, targetBrightness + 0,
+                                                       PidGain(0.2, 0.1, 0.1), isLeftEdge);
+    expectedList.push_back(dl2);
+    // ライントレース動作に続かないLRコマンドはwarningを出して無視する
+    DistanceStraight* ds = new DistanceStraight(100, 200);
+    expectedList.push_back(ds);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos,
+              actualOutput.find("Line recovery (maxRecoveryCount: 2, sweepAngle: 60.00)"));
+    EXPECT_NE(string::npos, parseOutput.find("LR must follow a line tracing command"));
+  }
+
+  TEST(MotionParserTest, createArmProfileMotions)
+  {
+    const char* filePath = "../test/test_data/ArmProfileParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+
+    // logRunning()のログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto a : actualList) {
+      a->logRunning();
+    }
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // test_data/ArmProfileParserTestData.csvに従って順にインスタンス化する
+    std::vector<Motion*> expectedList;
+    ArmMotion* am = new ArmMotion(60, 40);
+    expectedList.push_back(am);
+    // APコマンドは軌道の角速度・角加速度の上限を設定する
+    ArmMotion* ap = new ArmMotion(-60, 40);
+    ap->setProfile(150.0, 600.0);
+    expectedList.push_back(ap);
+
+    // expectedListのログを取る
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    for(const auto e : expectedList) {
+      e->logRunning();
+    }
+    string expectedOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_EQ(expectedList.size(), actualList.size());
+    EXPECT_EQ(expectedOutput, actualOutput);  // ログが一致していることを確認する
+    EXPECT_NE(string::npos,
+              actualOutput.find("Arm profile (maxSpeed: 150.00, maxAcceleration: 600.00)"));
+  }
+
+  TEST(MotionParserTest, createAnomalyReactionMotions)
+  {
+    const char* filePath = "../test/test_data/AnomalyParserTestData.csv";
+    int targetBrightness = 45;
+    bool isLeftEdge = true;
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    std::vector<Motion*> actualList
+        = MotionParser::createMotions(filePath, targetBrightness, isLeftEdge);
+    string actualOutput = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    // ANコマンドは直前の動作に対処を設定し、動作の直後でない場合はwarningを出して無視する
+    ASSERT_EQ(3, actualList.size());
+    EXPECT_EQ(ANOMALY_REACTION::RETRY, actualList[0]->getAnomalyReaction());
+    EXPECT_EQ(ANOMALY_REACTION::ABORT, actualList[1]->getAnomalyReaction());
+    EXPECT_EQ(ANOMALY_REACTION::CONTINUE, actualList[2]->getAnomalyReaction());
+    EXPECT_NE(string::npos, actualOutput.find("AN must follow a motion command"));
+  }
+
   TEST(MotionParserTest, notCreateMotions)
   {
     const char* filePath = "../test/test_data/non_existent_file.csv";  // 存在しないファイル
@@ -0,0 +1,127 @@
+/**
+ * @file   MotionWatchdogTest.cpp
+ * @brief  MotionWatchdogクラスのテスト
+ * @author KatLab
+ */
+
+#include "MotionWatchdog.h"
+#include "DistanceStraight.h"
+#include "ColorStraight.h"
+#include "PwmRotation.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(MotionWatchdogTest, noLimit)
+  {
+    Timer timer;
+    MotionWatchdog::start(0, 0.0);
+    timer.sleep(1000);
+    Controller::setRightMotorPwm(100.0);
+    Controller::setLeftMotorPwm(100.0);
+
+    // 制限しない場合は打ち切らない
+    EXPECT_FALSE(MotionWatchdog::isExpired());
+    MotionWatchdog::stop();
+    Controller::stopMotor();
+  }
+
+  TEST(MotionWatchdogTest, timeout)
+  {
+    Timer timer;
+    MotionWatchdog::start(100, 0.0);
+    EXPECT_FALSE(MotionWatchdog::isExpired());
+    timer.sleep(100);
+
+    // 制限時間を超えたら打ち切り、監視を終えても記録は残る
+    EXPECT_TRUE(MotionWatchdog::isExpired());
+    EXPECT_TRUE(MotionWatchdog::isExpired());
+    MotionWatchdog::stop();
+    EXPECT_TRUE(MotionWatchdog::hasExpired());
+    EXPECT_FALSE(MotionWatchdog::isExpired());
+
+    // 監視を開始し直すと記録は破棄される
+    MotionWatchdog::start(100, 0.0);
+    EXPECT_FALSE(MotionWatchdog::hasExpired());
+    EXPECT_FALSE(MotionWatchdog::isExpired());
+    MotionWatchdog::stop();
+  }
+
+  TEST(MotionWatchdogTest, distance)
+  {
+    double distanceLimit = 50.0;
+    MotionWatchdog::start(0, distanceLimit);
+
+    // 制限距離を超えるまで走らせる(ダミーのモータは1回のPWM値の設定で角位置がpwm * 0.05進む)
+    bool isExpired = false;
+    for(int i = 0; i < 100 && !isExpired; i++) {
+      Controller::setRightMotorPwm(100.0);
+      Controller::setLeftMotorPwm(-100.0);
+      isExpired = MotionWatchdog::isExpired();
+    }
+    MotionWatchdog::stop();
+
+    // その場の回頭も走行距離に含め、打ち切ったときはモータを止める
+    EXPECT_TRUE(isExpired);
+    EXPECT_LE(distanceLimit, MotionWatchdog::getDistance());
+    EXPECT_EQ(0.0, Controller::getRightPwm());
+    EXPECT_EQ(0.0, Controller::getLeftPwm());
+  }
+
+  TEST(MotionWatchdogTest, notWatching)
+  {
+    Timer timer;
+    MotionWatchdog::start(0, 0.0);
+    MotionWatchdog::stop();
+    MotionWatchdog::start(100, 0.0);
+    MotionWatchdog::stop();
+    timer.sleep(200);
+
+    // 監視していない間は打ち切らない
+    EXPECT_FALSE(MotionWatchdog::isExpired());
+  }
+
+  TEST(MotionWatchdogTest, abortStraight)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    double distanceLimit = 100.0;
+    double targetDistance = 500.0;
+    DistanceStraight ds(targetDistance, 200.0);
+
+    int rightCount = Measurer::getRightCount();
+    int leftCount = Measurer::getLeftCount();
+    double initialDistance = Mileage::calculateMileage(rightCount, leftCount);
+    MotionWatchdog::start(0, distanceLimit);
+    ds.run();
+    MotionWatchdog::stop();
+
+    // 目標距離に達する前に、制限距離を超えたところで打ち切られる
+    double distance = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount())
+                      - initialDistance;
+    EXPECT_TRUE(MotionWatchdog::hasExpired());
+    EXPECT_LE(distanceLimit, distance);
+    EXPECT_GT(targetDistance, distance);
+  }
+
+  TEST(MotionWatchdogTest, defaultLimit)
+  {
+    // 終わらないおそれのある動作は種類ごとの既定の制限を持つ
+    ColorStraight cs(COLOR::RED, 200.0);
+    EXPECT_EQ(ColorStraight::DEFAULT_TIME_LIMIT, cs.getTimeLimit());
+    EXPECT_DOUBLE_EQ(ColorStraight::DEFAULT_DISTANCE_LIMIT, cs.getDistanceLimit());
+    PwmRotation pr(90, 60, true);
+    EXPECT_EQ(PwmRotation::DEFAULT_TIME_LIMIT, pr.getTimeLimit());
+    DistanceStraight ds(100.0, 200.0);
+    EXPECT_EQ(0, ds.getTimeLimit());
+    EXPECT_DOUBLE_EQ(0.0, ds.getDistanceLimit());
+
+    // 設定した制限で既定の制限を上書きする
+    cs.setWatchdogLimit(3000, 0.0, WATCHDOG_REACTION::ABORT);
+    EXPECT_EQ(3000, cs.getTimeLimit());
+    EXPECT_DOUBLE_EQ(0.0, cs.getDistanceLimit());
+    EXPECT_EQ(WATCHDOG_REACTION::ABORT, cs.getWatchdogReaction());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,80 @@
+/**
+ * @file   ObstacleApproachTest.cpp
+ * @brief  ObstacleApproachクラスのテスト
+ * @author KatLab
+ */
+
+#include "ObstacleApproach.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(ObstacleApproachTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SonarSampler::reset();
+    // ダミーの超音波センサを15cmにそろえてから近づく
+    while(Measurer::getForwardDistance() != 15) {
+    }
+    ObstacleApproach oa(200.0, 50, 150, 100000.0);
+
+    double initialDistance
+        = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+    oa.run();
+    double distance
+        = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount());
+
+    // 障害物までの距離がstopDistance以下になるまで進んでから止まる
+    EXPECT_TRUE(oa.isReached());
+    EXPECT_GE(50, SonarSampler::getDistance());
+    EXPECT_LT(initialDistance, distance);
+  }
+
+  TEST(ObstacleApproachTest, runWithoutObstacle)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SonarSampler::reset();
+    // ダミーの超音波センサを15cmにそろえ、障害物が近づく前にmaxDistanceに達して打ち切る
+    while(Measurer::getForwardDistance() != 15) {
+    }
+    ObstacleApproach oa(200.0, 0, 0, 10.0);
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    oa.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_FALSE(oa.isReached());
+    EXPECT_NE(string::npos,
+              output.find("ObstacleApproach did not find an obstacle within 10.00mm"));
+  }
+
+  TEST(ObstacleApproachTest, calcApproachSpeed)
+  {
+    ObstacleApproach oa(200.0, 50, 150, 1000.0);
+
+    EXPECT_DOUBLE_EQ(200.0, oa.calcApproachSpeed(1000));
+    EXPECT_DOUBLE_EQ(200.0, oa.calcApproachSpeed(150));
+    EXPECT_DOUBLE_EQ(125.0, oa.calcApproachSpeed(100));
+    EXPECT_DOUBLE_EQ(ObstacleApproach::MIN_SPEED, oa.calcApproachSpeed(50));
+    EXPECT_DOUBLE_EQ(ObstacleApproach::MIN_SPEED, oa.calcApproachSpeed(0));
+  }
+
+  TEST(ObstacleApproachTest, runInvalidParameter)
+  {
+    ObstacleApproach zeroSpeed(0.0, 50, 150, 1000.0);
+    ObstacleApproach reversedDistance(200.0, 150, 50, 1000.0);
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    zeroSpeed.run();
+    reversedDistance.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos,
+              output.find("The targetSpeed value passed to ObstacleApproach is 0.00"));
+    EXPECT_NE(string::npos,
+              output.find("The slowDistance value passed to ObstacleApproach is 50"));
+  }
+}  // namespace etrobocon2023_test
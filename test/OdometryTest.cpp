@@ -0,0 +1,109 @@
+/**
+ * @file   OdometryTest.cpp
+ * @brief  Odometryクラスのテスト
+ * @author KatLab
+ */
+
+#include "Odometry.h"
+#include "Controller.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(OdometryTest, straight)
+  {
+    Odometry::reset();
+    int initRightCount = Measurer::getRightTotalCount();
+    for(int i = 0; i < 100; i++) {
+      Controller::setRightMotorPwm(100);
+      Controller::setLeftMotorPwm(100);
+      Odometry::update();
+    }
+    Controller::stopMotor();
+
+    // 正面(x軸正方向)に進み、向きは変わらない
+    double expected
+        = Mileage::calculateWheelMileage(Measurer::getRightTotalCount() - initRightCount);
+    Pose pose = Odometry::getPose();
+    EXPECT_NEAR(expected, pose.x, 0.001);
+    EXPECT_NEAR(0.0, pose.y, 0.001);
+    EXPECT_NEAR(0.0, pose.theta, 0.001);
+  }
+
+  TEST(OdometryTest, rotateAnticlockwise)
+  {
+    Odometry::reset();
+    // 左右の車輪を逆向きに回すとその場で回頭する(右車輪が前進すると反時計回り)
+    int initRightCount = Measurer::getRightTotalCount();
+    for(int i = 0; i < 20; i++) {
+      Controller::setRightMotorPwm(100);
+      Controller::setLeftMotorPwm(-100);
+      Odometry::update();
+    }
+    Controller::stopMotor();
+
+    double wheelDistance
+        = Mileage::calculateWheelMileage(Measurer::getRightTotalCount() - initRightCount);
+    double expected = 2.0 * wheelDistance / TREAD;
+    Pose pose = Odometry::getPose();
+    EXPECT_NEAR(0.0, pose.x, 0.001);
+    EXPECT_NEAR(0.0, pose.y, 0.001);
+    EXPECT_NEAR(Odometry::normalizeAngle(expected), pose.theta, 0.001);
+    EXPECT_LT(0.0, pose.theta);
+  }
+
+  TEST(OdometryTest, keepPoseAfterResetCount)
+  {
+    Odometry::reset();
+    for(int i = 0; i < 10; i++) {
+      Controller::setRightMotorPwm(100);
+      Controller::setLeftMotorPwm(100);
+      Odometry::update();
+    }
+    Pose expected = Odometry::getPose();
+
+    // 動作の切り替えで角位置が初期化されても位置は変わらない
+    Measurer::resetCount();
+    Odometry::update();
+    Controller::stopMotor();
+
+    Pose actual = Odometry::getPose();
+    EXPECT_DOUBLE_EQ(expected.x, actual.x);
+    EXPECT_DOUBLE_EQ(expected.y, actual.y);
+    EXPECT_DOUBLE_EQ(expected.theta, actual.theta);
+  }
+
+  TEST(OdometryTest, setPose)
+  {
+    Odometry::setPose({ 100.0, 200.0, M_PI / 2.0 });
+    // 左向き(y軸正方向)に進む
+    for(int i = 0; i < 10; i++) {
+      Controller::setRightMotorPwm(100);
+      Controller::setLeftMotorPwm(100);
+      Odometry::update();
+    }
+    Controller::stopMotor();
+
+    Pose pose = Odometry::getPose();
+    EXPECT_NEAR(100.0, pose.x, 0.001);
+    EXPECT_LT(200.0, pose.y);
+    EXPECT_NEAR(M_PI / 2.0, pose.theta, 0.001);
+  }
+
+  TEST(OdometryTest, calcDistanceAndAngle)
+  {
+    Odometry::setPose({ 0.0, 0.0, M_PI / 2.0 });
+    EXPECT_DOUBLE_EQ(500.0, Odometry::calcDistanceTo(300.0, 400.0));
+    EXPECT_NEAR(-M_PI / 2.0, Odometry::calcAngleTo(0.0), 0.001);
+    // 半周以上の回転は逆回りにする
+    EXPECT_NEAR(-M_PI * 3.0 / 4.0, Odometry::calcAngleTo(M_PI * 3.0 / 4.0 + M_PI), 0.001);
+  }
+
+  TEST(OdometryTest, normalizeAngle)
+  {
+    EXPECT_NEAR(0.0, Odometry::normalizeAngle(2.0 * M_PI), 0.001);
+    EXPECT_NEAR(M_PI / 2.0, Odometry::normalizeAngle(-M_PI * 3.0 / 2.0), 0.001);
+    EXPECT_NEAR(M_PI, Odometry::normalizeAngle(-M_PI), 0.001);
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,81 @@
+/**
+ * @file   ParallelMotionTest.cpp
+ * @brief  ParallelMotionクラスのテスト
+ * @author KatLab
+ */
+
+#include "ParallelMotion.h"
+#include "DistanceStraight.h"
+#include "SpeedEstimator.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(ParallelMotionTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Controller::stopArmMotor();
+    SpeedEstimator::reset();
+    Measurer::resetArmMotorCount();
+    double targetDistance = 300.0;
+    DistanceStraight ds(targetDistance, 200.0);
+    ArmMotion am(60, 40);
+    ParallelMotion pm(ds, am);
+
+    int rightCount = Measurer::getRightCount();
+    int leftCount = Measurer::getLeftCount();
+    double initialDistance = Mileage::calculateMileage(rightCount, leftCount);
+    pm.run();
+
+    // 走行動作とアーム動作の両方が終わっている
+    double distance = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount())
+                      - initialDistance;
+    EXPECT_LE(targetDistance, distance);
+    EXPECT_NEAR(-60, Measurer::getArmMotorCount(), ArmController::SETTLE_TOLERANCE);
+    EXPECT_TRUE(am.isSettled());
+  }
+
+  TEST(ParallelMotionTest, runArmAfterDrive)
+  {
+    Controller::stopArmMotor();
+    Measurer::resetArmMotorCount();
+    // 目標速度が0のため走行動作はすぐに終わる
+    DistanceStraight ds(300.0, 0.0);
+    ArmMotion am(-60, 40);
+    ParallelMotion pm(ds, am);
+
+    pm.run();
+
+    // 走行動作が終わった後もアーム動作は静定するまで続く
+    EXPECT_NEAR(60, Measurer::getArmMotorCount(), ArmController::SETTLE_TOLERANCE);
+    EXPECT_TRUE(am.isSettled());
+  }
+
+  TEST(ParallelMotionTest, runInvalidArm)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Controller::stopArmMotor();
+    SpeedEstimator::reset();
+    Measurer::resetArmMotorCount();
+    double targetDistance = 100.0;
+    DistanceStraight ds(targetDistance, 200.0);
+    // PWM値が0のためアーム動作は行わない
+    ArmMotion am(60, 0);
+    ParallelMotion pm(ds, am);
+
+    int rightCount = Measurer::getRightCount();
+    int leftCount = Measurer::getLeftCount();
+    double initialDistance = Mileage::calculateMileage(rightCount, leftCount);
+    pm.run();
+
+    // 走行動作だけが行われる
+    double distance = Mileage::calculateMileage(Measurer::getRightCount(), Measurer::getLeftCount())
+                      - initialDistance;
+    EXPECT_LE(targetDistance, distance);
+    EXPECT_EQ(0, Measurer::getArmMotorCount());
+    EXPECT_FALSE(am.isSettled());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,83 @@
+/**
+ * @file   PidAutoTuningTest.cpp
+ * @brief  PidAutoTuningクラスとPidGainStoreクラスのテスト
+ * @author KatLab
+ */
+
+#include "PidAutoTuning.h"
+#include "PidGainStore.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // テストで使うゲインファイル
+  static const char* GAIN_FILE = "pid_auto_tuning_test.csv";
+
+  // ダミーの走行体でリレーフィードバック試験を行い、求めたゲインを保存する
+  TEST(PidAutoTuningTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    srand(0);
+    PidGainStore::clear();
+    bool isLeftEdge = true;
+    PidAutoTuning at(1000.0, 200.0, 45, 30.0, TUNING_RULE::TYREUS_LUYBEN, "", isLeftEdge);
+
+    at.run();
+
+    // 振動を計測し、正のPIDゲインを求める
+    PidGain gain = at.getTunedGain();
+    EXPECT_LT(0.0, gain.kp);
+    EXPECT_LT(0.0, gain.ki);
+    EXPECT_LT(0.0, gain.kd);
+    // 名前を指定していない場合は保存しない
+    PidGain stored(0.0, 0.0, 0.0);
+    EXPECT_FALSE(PidGainStore::findGain("", stored));
+  }
+
+  TEST(PidAutoTuningTest, invalidParameter)
+  {
+    bool isLeftEdge = true;
+    PidAutoTuning at(1000.0, 200.0, 45, 0.0, TUNING_RULE::ZIEGLER_NICHOLS, "", isLeftEdge);
+
+    // リレー出力が0の場合はWarningを出して調整しない
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    at.run();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos, output.find("The relayPwm value passed to PidAutoTuning is 0.00"));
+    EXPECT_DOUBLE_EQ(0.0, at.getTunedGain().kp);
+  }
+
+  TEST(PidAutoTuningTest, saveAndLoadGain)
+  {
+    PidGainStore::clear();
+    PidGainStore::setGain("trace", PidGain(0.5, 0.25, 0.125));
+    PidGainStore::setGain("curve", PidGain(0.8, 0.1, 0.08));
+    // 同じ名前のゲインは上書きする
+    PidGainStore::setGain("trace", PidGain(0.6, 0.3, 0.15));
+    ASSERT_TRUE(PidGainStore::save(GAIN_FILE));
+
+    PidGainStore::clear();
+    PidGain gain(0.0, 0.0, 0.0);
+    EXPECT_FALSE(PidGainStore::findGain("trace", gain));
+    ASSERT_TRUE(PidGainStore::load(GAIN_FILE));
+    remove(GAIN_FILE);
+
+    ASSERT_TRUE(PidGainStore::findGain("trace", gain));
+    EXPECT_DOUBLE_EQ(0.6, gain.kp);
+    EXPECT_DOUBLE_EQ(0.3, gain.ki);
+    EXPECT_DOUBLE_EQ(0.15, gain.kd);
+    ASSERT_TRUE(PidGainStore::findGain("curve", gain));
+    EXPECT_DOUBLE_EQ(0.8, gain.kp);
+    EXPECT_FALSE(PidGainStore::findGain("unknown", gain));
+    PidGainStore::clear();
+  }
+
+  TEST(PidAutoTuningTest, loadMissingFile)
+  {
+    EXPECT_FALSE(PidGainStore::load("not_exist_gain_file.csv"));
+  }
+}  // namespace etrobocon2023_test
@@ -275,4 +275,138 @@ namespace etrobocon2023_test {
     EXPECT_DOUBLE_EQ(expected, actualPid.calculatePid(currentValue));
   }
 
+  // 偏差の累積の上限のテスト
+  TEST(PidTest, calculatePidIntegralLimit)
+  {
+    constexpr double DELTA = 0.01;
+    double ki = 1.0;
+    double targetValue = 70;
+    double integralLimit = 0.5;
+    Pid actualPid(0.0, ki, 0.0, targetValue, 10.0);
+    actualPid.setIntegralLimit(integralLimit);
+    double currentValue = 60;  // 偏差は10で一定
+
+    // 上限に達するまでは台形積分どおりに累積する
+    double expected = ((10.0 + 10.0) * DELTA / 2) * ki;
+    EXPECT_DOUBLE_EQ(expected, actualPid.calculatePid(currentValue));
+    // 上限に達した後は累積が増えない
+    for(int i = 0; i < 100; i++) {
+      actualPid.calculatePid(currentValue);
+    }
+    EXPECT_DOUBLE_EQ(integralLimit * ki, actualPid.calculatePid(currentValue));
+    // 負の向きも同様に制限する
+    currentValue = 80;
+    for(int i = 0; i < 200; i++) {
+      actualPid.calculatePid(currentValue);
+    }
+    EXPECT_DOUBLE_EQ(-integralLimit * ki, actualPid.calculatePid(currentValue));
+  }
+
+  // 操作量の制限とバックカリキュレーションのテスト
+  TEST(PidTest, calculatePidOutputLimit)
+  {
+    constexpr double DELTA = 0.01;
+    double kp = 2.0;
+    double ki = 10.0;
+    double targetValue = 100;
+    double outputMax = 100;
+    double backCalculationGain = 1.0;
+    Pid actualPid(kp, ki, 0.0, targetValue, 100.0);
+    actualPid.setOutputLimit(-outputMax, outputMax, backCalculationGain);
+
+    // 飽和中は操作量が上限に収まる
+    double currentValue = 0;  // 偏差は100
+    double integral = ((100.0 + 100.0) * DELTA / 2);
+    double output = kp * 100.0 + ki * integral;  // 210
+    EXPECT_DOUBLE_EQ(outputMax, actualPid.calculatePid(currentValue));
+    // 飽和した分だけ偏差の累積が戻る
+    integral += backCalculationGain * (outputMax - output) / ki;
+    EXPECT_NEAR(-10.0, integral, 1e-9);
+
+    // 偏差が0になると、戻した累積の分だけ逆向きの操作量になる
+    currentValue = 100;
+    integral += ((100.0 + 0.0) * DELTA / 2);
+    double expected = ki * integral;
+    EXPECT_DOUBLE_EQ(fmax(expected, -outputMax), actualPid.calculatePid(currentValue));
+  }
+
+  // バックカリキュレーションによりワインドアップ後の行き過ぎが小さくなるテスト
+  TEST(PidTest, calculatePidAntiWindup)
+  {
+    double kp = 1.0;
+    double ki = 5.0;
+    double targetValue = 100;
+    Pid windupPid(kp, ki, 0.0, targetValue);
+    windupPid.setOutputLimit(-100, 100, 0.0);  // 操作量の制限のみ
+    Pid antiWindupPid(kp, ki, 0.0, targetValue);
+    antiWindupPid.setOutputLimit(-100, 100, 1.0);
+
+    // 長時間飽和させる
+    for(int i = 0; i < 300; i++) {
+      windupPid.calculatePid(0);
+      antiWindupPid.calculatePid(0);
+    }
+    // 目標値に達した直後の操作量
+    double windupOutput = windupPid.calculatePid(targetValue);
+    double antiWindupOutput = antiWindupPid.calculatePid(targetValue);
+    EXPECT_DOUBLE_EQ(100, windupOutput);  // 累積が残り、上限に張り付いたまま
+    EXPECT_GT(100, antiWindupOutput);
+  }
+
+  // D制御の一次遅れフィルタのテスト
+  TEST(PidTest, calculatePidDerivativeFilter)
+  {
+    constexpr double DELTA = 0.01;
+    double kd = 1.0;
+    double targetValue = 0;
+    double filterTimeConstant = 0.03;
+    Pid actualPid(0.0, 0.0, kd, targetValue, 0.0, 0.001);
+    actualPid.setDerivativeFilter(filterTimeConstant);
+
+    // 初回はフィルタを通さない
+    double deviation = -10.0;
+    double difference = deviation / DELTA;
+    double filtered = difference;
+    EXPECT_DOUBLE_EQ(kd * filtered, actualPid.calculatePid(10.0));
+
+    // 2回目以降は時定数に応じて変化率が平滑化される
+    double alpha = DELTA / (filterTimeConstant + DELTA);
+    double preDeviation = deviation;
+    deviation = -30.0;
+    difference = (deviation - preDeviation) / DELTA;
+    filtered += alpha * (difference - filtered);
+    EXPECT_DOUBLE_EQ(kd * filtered, actualPid.calculatePid(30.0));
+
+    // 偏差が一定になると変化率は0に近づく
+    double output = 0.0;
+    for(int i = 0; i < 100; i++) {
+      output = actualPid.calculatePid(30.0);
+    }
+    EXPECT_NEAR(0.0, output, 1e-6);
+  }
+
+  // 新しいモードを設定しない場合は従来どおりの計算をするテスト
+  TEST(PidTest, calculatePidLegacyDefault)
+  {
+    constexpr double DELTA = 0.01;
+    double kp = 0.6;
+    double ki = 0.02;
+    double kd = 0.03;
+    double targetValue = 70;
+    double timeConstant = 0.001;
+    Pid actualPid(kp, ki, kd, targetValue, 0.0, timeConstant);
+    double integral = 0.0;
+    double preDeviation = 0.0;
+    for(int n = 0; n < 50; n++) {
+      double currentValue = 20 + n * 3;
+      double currentDeviation = targetValue - currentValue;
+      integral += (preDeviation + currentDeviation) * DELTA / 2;
+      double d = (currentDeviation - preDeviation) * kd / DELTA;
+      d = d / (1.0 + timeConstant * (fabs(d) / kp));
+      preDeviation = currentDeviation;
+      double expected = kp * currentDeviation + ki * integral + d;
+      EXPECT_DOUBLE_EQ(expected, actualPid.calculatePid(currentValue));
+    }
+  }
+
 }  // namespace etrobocon2023_test
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**
+ * @file   RelayAutoTunerTest.cpp
+ * @brief  RelayAutoTunerクラスのテスト
+ * @author KatLab
+ */
+
+#include "RelayAutoTuner.h"
+#include <gtest/gtest.h>
+#include <deque>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // むだ時間つき積分系(y' = K * u(t - L))をリレーで振動させる
+  // 理論上、振動の周期は4L、振幅はK*d*L(d:リレー出力の大きさ)になる
+  static void runIntegratorWithDelay(RelayAutoTuner& tuner, double k, double delay,
+                                     int maxStepCount)
+  {
+    const double DT = 0.01;  // 制御周期[s]
+    deque<double> inputs(static_cast<int>(delay / DT), 0.0);  // むだ時間分の入力
+    double value = 0.0;
+    for(int i = 0; i < maxStepCount && !tuner.isFinished(); i++) {
+      uint64_t time = static_cast<uint64_t>(i) * 10000;
+      inputs.push_back(tuner.update(value, time));
+      value += k * inputs.front() * DT;
+      inputs.pop_front();
+    }
+  }
+
+  TEST(RelayAutoTunerTest, measureIntegratorWithDelay)
+  {
+    double k = 2.0;
+    double delay = 0.1;
+    double relayAmplitude = 10.0;
+    RelayAutoTuner tuner(0.0, relayAmplitude, 0.01);
+
+    runIntegratorWithDelay(tuner, k, delay, 10000);
+
+    // 離散時間で模擬するため、リレー出力が現在値に現れるまで制御周期1回分の遅れが加わる
+    double effectiveDelay = delay + 0.01;
+    ASSERT_TRUE(tuner.isFinished());
+    EXPECT_NEAR(4.0 * effectiveDelay, tuner.getUltimatePeriod(), 0.02);
+    EXPECT_NEAR(k * relayAmplitude * effectiveDelay, tuner.getAmplitude(), 0.1);
+    // 記述関数法による限界ゲイン
+    double expectedGain = 4.0 * relayAmplitude / (M_PI * tuner.getAmplitude());
+    EXPECT_NEAR(expectedGain, tuner.getUltimateGain(), 0.01);
+  }
+
+  TEST(RelayAutoTunerTest, relayOutput)
+  {
+    RelayAutoTuner tuner(50.0, -20.0, 3.0);
+    // 偏差が正の場合は正のリレー出力(大きさは絶対値)
+    EXPECT_DOUBLE_EQ(20.0, tuner.update(40.0, 0));
+    // ヒステリシス幅の内側では切り替えない
+    EXPECT_DOUBLE_EQ(20.0, tuner.update(52.0, 10000));
+    // ヒステリシス幅を超えたら切り替える
+    EXPECT_DOUBLE_EQ(-20.0, tuner.update(54.0, 20000));
+    EXPECT_DOUBLE_EQ(-20.0, tuner.update(48.0, 30000));
+    EXPECT_DOUBLE_EQ(20.0, tuner.update(46.0, 40000));
+  }
+
+  TEST(RelayAutoTunerTest, notFinished)
+  {
+    RelayAutoTuner tuner(50.0, 20.0, 3.0);
+    // 振動しない場合は計測が終わらず、限界ゲインと限界周期は0
+    for(int i = 0; i < 100; i++) {
+      tuner.update(40.0, i * 10000);
+    }
+    EXPECT_FALSE(tuner.isFinished());
+    EXPECT_DOUBLE_EQ(0.0, tuner.getUltimatePeriod());
+    EXPECT_DOUBLE_EQ(0.0, tuner.getUltimateGain());
+  }
+
+  TEST(RelayAutoTunerTest, calcGain)
+  {
+    double ku = 2.0;
+    double tu = 0.4;
+    // ジーグラ・ニコルス法: Kp=0.6Ku, Ti=Tu/2, Td=Tu/8
+    PidGain zn = RelayAutoTuner::calcGain(ku, tu, TUNING_RULE::ZIEGLER_NICHOLS);
+    EXPECT_DOUBLE_EQ(1.2, zn.kp);
+    EXPECT_DOUBLE_EQ(1.2 / 0.2, zn.ki);
+    EXPECT_DOUBLE_EQ(1.2 * 0.05, zn.kd);
+    // タイリュス・ルイベン法: Kp=Ku/2.2, Ti=2.2Tu, Td=Tu/6.3
+    PidGain tl = RelayAutoTuner::calcGain(ku, tu, TUNING_RULE::TYREUS_LUYBEN);
+    EXPECT_DOUBLE_EQ(ku / 2.2, tl.kp);
+    EXPECT_DOUBLE_EQ(ku / 2.2 / (2.2 * tu), tl.ki);
+    EXPECT_DOUBLE_EQ(ku / 2.2 * tu / 6.3, tl.kd);
+    // タイリュス・ルイベン法の方がゲインが小さい(行き過ぎが小さい)
+    EXPECT_GT(zn.kp, tl.kp);
+    EXPECT_GT(zn.ki, tl.ki);
+    // 限界周期が0以下の場合は全て0
+    PidGain invalid = RelayAutoTuner::calcGain(ku, 0.0, TUNING_RULE::ZIEGLER_NICHOLS);
+    EXPECT_DOUBLE_EQ(0.0, invalid.kp);
+    EXPECT_DOUBLE_EQ(0.0, invalid.ki);
+    EXPECT_DOUBLE_EQ(0.0, invalid.kd);
+  }
+
+  TEST(RelayAutoTunerTest, ruleToString)
+  {
+    EXPECT_STREQ("ZN", RelayAutoTuner::ruleToString(TUNING_RULE::ZIEGLER_NICHOLS));
+    EXPECT_STREQ("TL", RelayAutoTuner::ruleToString(TUNING_RULE::TYREUS_LUYBEN));
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,73 @@
+/**
+ * @file   SonarSamplerTest.cpp
+ * @brief  SonarSamplerクラスのテスト
+ * @author KatLab
+ */
+
+#include "SonarSampler.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(SonarSamplerTest, sample)
+  {
+    SonarSampler::reset();
+    // ダミーの超音波センサは呼び出すたびに1cmずつ近づく(0の次は20に戻る)ので、15cmにそろえる
+    while(Measurer::getForwardDistance() != 15) {
+    }
+    SonarSampler::sample();  // 14cm
+    EXPECT_EQ(140, SonarSampler::getDistance());
+    SonarSampler::sample();  // 13cm
+    SonarSampler::sample();  // 12cm
+
+    // 直近3回の計測値の中央値を[mm]で保持する
+    EXPECT_EQ(130, SonarSampler::getDistance());
+    EXPECT_LT(0u, SonarSampler::getSampledTime());
+  }
+
+  TEST(SonarSamplerTest, getCachedDistance)
+  {
+    Timer timer;
+    SonarSampler::reset();
+    // 保持している値が新しい間はセンサへ問い合わせない
+    int distance = SonarSampler::getDistance();
+    uint64_t sampledTime = SonarSampler::getSampledTime();
+    for(int i = 0; i < 5; i++) {
+      timer.sleep(10);
+      EXPECT_EQ(distance, SonarSampler::getDistance());
+      EXPECT_EQ(sampledTime, SonarSampler::getSampledTime());
+    }
+
+    // 保持している値が古くなったらその場で計測し直す
+    timer.sleep(SonarSampler::STALE_TIME / 1000);
+    SonarSampler::getDistance();
+    EXPECT_LT(sampledTime, SonarSampler::getSampledTime());
+  }
+
+  TEST(SonarSamplerTest, notSampleAfterStart)
+  {
+    Timer timer;
+    SonarSampler::reset();
+    SonarSampler::sample();
+    uint64_t sampledTime = SonarSampler::getSampledTime();
+
+    // 計測タスクを開始した後は、保持している値が古くなってもgetDistance()から計測しない
+    SonarSampler::start();
+    timer.sleep(SonarSampler::STALE_TIME / 1000 * 2);
+    SonarSampler::getDistance();
+    EXPECT_EQ(sampledTime, SonarSampler::getSampledTime());
+    SonarSampler::stop();
+
+    // 停止した後は再びその場で計測する
+    SonarSampler::getDistance();
+    EXPECT_LT(sampledTime, SonarSampler::getSampledTime());
+  }
+
+  TEST(SonarSamplerTest, reset)
+  {
+    SonarSampler::sample();
+    SonarSampler::reset();
+    EXPECT_EQ(0u, SonarSampler::getSampledTime());
+  }
+}  // namespace etrobocon2023_test
@@ -115,4 +115,90 @@ namespace etrobocon2023_test {
     EXPECT_GT(0, actualRightPwm);
     EXPECT_EQ(0, actualLeftPwm);
   }
-}  // namespace etrobocon2023_test
\ No newline at end of file
+
+  TEST(SpeedCalculatorTest, calcFeedforwardPwm)
+  {
+    // 速度が0のときは0
+    EXPECT_EQ(0, SpeedCalculator::calcRightFeedforwardPwm(0.0));
+    EXPECT_EQ(0, SpeedCalculator::calcLeftFeedforwardPwm(0.0));
+    // 速度が大きいほどPWM値が大きい
+    EXPECT_LT(0, SpeedCalculator::calcRightFeedforwardPwm(100.0));
+    EXPECT_LT(SpeedCalculator::calcRightFeedforwardPwm(100.0),
+              SpeedCalculator::calcRightFeedforwardPwm(300.0));
+    EXPECT_LT(SpeedCalculator::calcLeftFeedforwardPwm(100.0),
+              SpeedCalculator::calcLeftFeedforwardPwm(300.0));
+    // 後退時は符号が反転する
+    EXPECT_DOUBLE_EQ(-SpeedCalculator::calcRightFeedforwardPwm(250.0),
+                     SpeedCalculator::calcRightFeedforwardPwm(-250.0));
+    EXPECT_DOUBLE_EQ(-SpeedCalculator::calcLeftFeedforwardPwm(250.0),
+                     SpeedCalculator::calcLeftFeedforwardPwm(-250.0));
+  }
+
+  TEST(SpeedCalculatorTest, calcFeedforwardSpeed)
+  {
+    // 不感帯内のPWM値では0
+    EXPECT_EQ(0, SpeedCalculator::calcRightFeedforwardSpeed(0.0));
+    EXPECT_EQ(0, SpeedCalculator::calcLeftFeedforwardSpeed(5.0));
+    // フィードフォワードPWM値の逆算になっている
+    double pwm = SpeedCalculator::calcRightFeedforwardPwm(250.0);
+    EXPECT_NEAR(250.0, SpeedCalculator::calcRightFeedforwardSpeed(pwm), 0.001);
+    pwm = SpeedCalculator::calcLeftFeedforwardPwm(-250.0);
+    EXPECT_NEAR(-250.0, SpeedCalculator::calcLeftFeedforwardSpeed(pwm), 0.001);
+  }
+
+  TEST(SpeedCalculatorTest, setTargetSpeed)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedCalculator speedCalc(100.0);
+    double slowPwm = speedCalc.calcRightPwmFromSpeed();
+    // 目標速度を上げるとフィードフォワード値の差だけPWM値が大きくなる
+    speedCalc.setTargetSpeed(300.0);
+    double fastPwm = speedCalc.calcRightPwmFromSpeed();
+    EXPECT_LT(slowPwm, fastPwm);
+    EXPECT_LE(SpeedCalculator::calcRightFeedforwardPwm(300.0), speedCalc.calcLeftPwmFromSpeed());
+    // 目標速度を0にすると0を返す
+    speedCalc.setTargetSpeed(0.0);
+    EXPECT_EQ(0.0, speedCalc.calcRightPwmFromSpeed());
+    EXPECT_EQ(0.0, speedCalc.calcLeftPwmFromSpeed());
+  }
+
+  TEST(SpeedCalculatorTest, startFromFeedforwardPwm)
+  {
+    // 静止状態から計算しても、初回からフィードフォワード値以上のPWM値になる
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    double targetSpeed = 300.0;
+    SpeedCalculator speedCalc(targetSpeed);
+    double expectedRightPwm = SpeedCalculator::calcRightFeedforwardPwm(targetSpeed);
+    double expectedLeftPwm = SpeedCalculator::calcLeftFeedforwardPwm(targetSpeed);
+    EXPECT_LE(expectedRightPwm, speedCalc.calcRightPwmFromSpeed());
+    EXPECT_LE(expectedLeftPwm, speedCalc.calcLeftPwmFromSpeed());
+  }
+
+  TEST(SpeedCalculatorTest, reachTargetSpeedFromRest)
+  {
+    Timer timer;
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    double targetSpeed = 300.0;
+    SpeedCalculator speedCalc(targetSpeed);
+
+    // 静止状態から10周期だけ走行する
+    int initRightCount = Measurer::getRightCount();
+    int prevRightCount = initRightCount;
+    int rightCount = initRightCount;
+    for(int i = 0; i < 10; i++) {
+      Controller::setRightMotorPwm(speedCalc.calcRightPwmFromSpeed());
+      Controller::setLeftMotorPwm(speedCalc.calcLeftPwmFromSpeed());
+      timer.sleep(10);
+      prevRightCount = rightCount;
+      rightCount = Measurer::getRightCount();
+    }
+    Controller::stopMotor();
+
+    // 最後の周期の走行速度が目標速度の半分を超えている
+    double speed = Mileage::calculateWheelMileage(rightCount - prevRightCount) / 0.01;
+    EXPECT_LT(targetSpeed * 0.5, speed);
+  }
+}  // namespace etrobocon2023_test
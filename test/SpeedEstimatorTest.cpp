@@ -0,0 +1,114 @@
+/**
+ * @file   SpeedEstimatorTest.cpp
+ * @brief  SpeedEstimatorクラスのテスト
+ * @author KatLab
+ */
+
+#include "SpeedEstimator.h"
+#include "Controller.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(SpeedEstimatorTest, estimateConstantSpeed)
+  {
+    Timer timer;
+    const int pwm = 50;
+    // 一回のsetPWM()でダミーのモータカウントに加算される値はpwm * 0.05
+    double expected = Mileage::calculateWheelMileage(1) * pwm * 0.05 / 0.01;
+
+    SpeedEstimator::reset();
+    SpeedEstimator::update();
+    for(int i = 0; i < 100; i++) {
+      Controller::setRightMotorPwm(pwm);
+      Controller::setLeftMotorPwm(-pwm);
+      timer.sleep(10);
+      SpeedEstimator::update();
+    }
+    Controller::stopMotor();
+
+    // 角位置の量子化があっても一定速度に収束する
+    EXPECT_NEAR(expected, SpeedEstimator::getRightSpeed(), expected * 0.05);
+    EXPECT_NEAR(-expected, SpeedEstimator::getLeftSpeed(), expected * 0.05);
+    EXPECT_NEAR(0.0, SpeedEstimator::getRightAcceleration(), expected);
+  }
+
+  TEST(SpeedEstimatorTest, estimateAcceleration)
+  {
+    Timer timer;
+    SpeedEstimator::reset();
+    SpeedEstimator::update();
+    // PWM値を徐々に上げて加速する
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(i * 2);
+      Controller::setLeftMotorPwm(i * 2);
+      timer.sleep(10);
+      SpeedEstimator::update();
+    }
+    Controller::stopMotor();
+
+    EXPECT_LT(0.0, SpeedEstimator::getRightSpeed());
+    EXPECT_LT(0.0, SpeedEstimator::getRightAcceleration());
+    EXPECT_LT(0.0, SpeedEstimator::getLeftAcceleration());
+  }
+
+  TEST(SpeedEstimatorTest, ignoreUpdateInSameCycle)
+  {
+    Timer timer;
+    SpeedEstimator::reset();
+    SpeedEstimator::update();
+    timer.sleep(10);
+    SpeedEstimator::update();
+    uint64_t updatedTime = SpeedEstimator::getUpdatedTime();
+
+    // 同じ制御周期内で再度呼び出しても更新しない
+    SpeedEstimator::update();
+    EXPECT_EQ(updatedTime, SpeedEstimator::getUpdatedTime());
+  }
+
+  TEST(SpeedEstimatorTest, keepSpeedAfterResetCount)
+  {
+    Timer timer;
+    const int pwm = 50;
+    SpeedEstimator::reset();
+    SpeedEstimator::update();
+    for(int i = 0; i < 50; i++) {
+      Controller::setRightMotorPwm(pwm);
+      Controller::setLeftMotorPwm(pwm);
+      timer.sleep(10);
+      SpeedEstimator::update();
+    }
+    double speed = SpeedEstimator::getRightSpeed();
+
+    // 動作の切り替えで角位置が初期化されても速度は飛ばない
+    Measurer::resetCount();
+    Controller::setRightMotorPwm(pwm);
+    Controller::setLeftMotorPwm(pwm);
+    timer.sleep(10);
+    SpeedEstimator::update();
+    Controller::stopMotor();
+
+    EXPECT_NEAR(speed, SpeedEstimator::getRightSpeed(), speed * 0.2);
+  }
+
+  TEST(SpeedEstimatorTest, initializeAfterLongInterval)
+  {
+    Timer timer;
+    const int pwm = 50;
+    SpeedEstimator::reset();
+    SpeedEstimator::update();
+    for(int i = 0; i < 10; i++) {
+      Controller::setRightMotorPwm(pwm);
+      timer.sleep(10);
+      SpeedEstimator::update();
+    }
+    Controller::stopMotor();
+
+    // 間隔が空きすぎた場合は推定値を初期化する
+    timer.sleep(1000);
+    SpeedEstimator::update();
+    EXPECT_EQ(0.0, SpeedEstimator::getRightSpeed());
+    EXPECT_EQ(0.0, SpeedEstimator::getRightAcceleration());
+  }
+}  // namespace etrobocon2023_test
@@ -0,0 +1,105 @@
+/**
+ * @file   StallDetectorTest.cpp
+ * @brief  StallDetectorクラスのテスト
+ * @author KatLab
+ */
+
+#include "StallDetector.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // PWM値に見合った速度で車輪が回っている場合は異常なし
+  TEST(StallDetectorTest, noAnomaly)
+  {
+    Timer timer;
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    StallDetector detector;
+    for(int i = 0; i < 100; i++) {
+      Controller::setRightMotorPwm(60.0);
+      Controller::setLeftMotorPwm(60.0);
+      EXPECT_EQ(DRIVE_ANOMALY::NONE, detector.update(60.0, 60.0));
+      timer.sleep(10);
+    }
+    Controller::stopMotor();
+    EXPECT_EQ(DRIVE_ANOMALY::NONE, detector.getLastAnomaly());
+  }
+
+  // PWM値を指令しても車輪が回らない状態が続くとストールを検知する
+  TEST(StallDetectorTest, detectStall)
+  {
+    Timer timer;
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    StallDetector detector;
+    int detectedCount = 0;
+    uint64_t startTime = timer.nowMicro();
+    uint64_t detectedTime = 0;
+    for(int i = 0; i < 100; i++) {
+      // モータを動かさずに、PWM値を指令したものとして判定する
+      if(detector.update(80.0, 80.0) == DRIVE_ANOMALY::STALL) {
+        detectedCount++;
+        detectedTime = timer.nowMicro();
+      }
+      timer.sleep(10);
+    }
+
+    // 継続時間を超えてから1度だけ検知する
+    EXPECT_EQ(1, detectedCount);
+    EXPECT_LE(startTime + StallDetector::STALL_DURATION, detectedTime);
+    EXPECT_EQ(DRIVE_ANOMALY::STALL, detector.getLastAnomaly());
+    EXPECT_LE(startTime + StallDetector::STALL_DURATION, detector.getLastAnomalyTime());
+  }
+
+  // ストールの疑いが継続時間に満たずに解消した場合は検知しない
+  TEST(StallDetectorTest, notDetectShortStall)
+  {
+    Timer timer;
+    Controller::stopMotor();
+    SpeedEstimator::reset();
+    StallDetector detector;
+    for(int i = 0; i < 10; i++) {
+      EXPECT_EQ(DRIVE_ANOMALY::NONE, detector.update(80.0, 80.0));
+      timer.sleep(10);
+    }
+    detector.reset();
+    for(int i = 0; i < 20; i++) {
+      EXPECT_EQ(DRIVE_ANOMALY::NONE, detector.update(80.0, 80.0));
+      timer.sleep(10);
+    }
+  }
+
+  // PWM値に対して車輪が回りすぎる状態が続くとスリップを検知する
+  TEST(StallDetectorTest, detectSlip)
+  {
+    Timer timer;
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    StallDetector detector;
+    int detectedCount = 0;
+    for(int i = 0; i < 100; i++) {
+      // 車輪を回しつつ、PWM値を指令していないものとして判定する
+      Controller::setRightMotorPwm(100.0);
+      Controller::setLeftMotorPwm(100.0);
+      if(detector.update(0.0, 0.0) == DRIVE_ANOMALY::SLIP) {
+        detectedCount++;
+      }
+      timer.sleep(10);
+    }
+    Controller::stopMotor();
+
+    EXPECT_EQ(1, detectedCount);
+    EXPECT_EQ(DRIVE_ANOMALY::SLIP, detector.getLastAnomaly());
+  }
+
+  TEST(StallDetectorTest, anomalyToString)
+  {
+    EXPECT_STREQ("NONE", StallDetector::anomalyToString(DRIVE_ANOMALY::NONE));
+    EXPECT_STREQ("STALL", StallDetector::anomalyToString(DRIVE_ANOMALY::STALL));
+    EXPECT_STREQ("SLIP", StallDetector::anomalyToString(DRIVE_ANOMALY::SLIP));
+  }
+}  // namespace etrobocon2023_test
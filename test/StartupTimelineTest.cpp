@@ -0,0 +1,50 @@
+/**
+ * @file   StartupTimelineTest.cpp
+ * @brief  StartupTimelineクラスのテスト
+ * @author KatLab
+ */
+
+#include "StartupTimeline.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  TEST(StartupTimelineTest, markAndLogSummary)
+  {
+    Timer timer;
+    StartupTimeline::begin();
+    timer.sleep(100);
+    StartupTimeline::mark("first");
+    timer.sleep(300);
+    StartupTimeline::mark("second");
+
+    ASSERT_EQ(2, StartupTimeline::getStepCount());
+    // 各段階の所要時間は前の段階の終了からの時間
+    EXPECT_LE(100000u, StartupTimeline::getStepDuration(0));
+    EXPECT_GT(300000u, StartupTimeline::getStepDuration(0));
+    EXPECT_LE(300000u, StartupTimeline::getStepDuration(1));
+    EXPECT_EQ(StartupTimeline::getStepDuration(0) + StartupTimeline::getStepDuration(1),
+              StartupTimeline::getTotalDuration());
+    EXPECT_EQ(0u, StartupTimeline::getStepDuration(2));
+
+    testing::internal::CaptureStdout();  // 標準出力キャプチャ開始
+    StartupTimeline::logSummary();
+    string output = testing::internal::GetCapturedStdout();  // キャプチャ終了
+
+    EXPECT_NE(string::npos, output.find("Startup timeline:"));
+    EXPECT_NE(string::npos, output.find("first"));
+    EXPECT_NE(string::npos, output.find("second"));
+    EXPECT_NE(string::npos, output.find("total"));
+  }
+
+  TEST(StartupTimelineTest, maxStepCount)
+  {
+    StartupTimeline::begin();
+    for(int i = 0; i < StartupTimeline::MAX_STEP_COUNT + 3; i++) {
+      StartupTimeline::mark("step");
+    }
+    // 上限を超えた段階は記録しない
+    EXPECT_EQ(StartupTimeline::MAX_STEP_COUNT, StartupTimeline::getStepCount());
+  }
+}  // namespace etrobocon2023_test
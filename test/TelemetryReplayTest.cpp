@@ -0,0 +1,169 @@
+/**
+ * @file   TelemetryReplayTest.cpp
+ * @brief  TelemetryRecorderで記録した走行データの再生テスト
+ * @author KatLab
+ */
+
+#include "TelemetryRecorder.h"
+#include "TelemetryReplay.h"
+#include "DistanceLineTracing.h"
+#include "DistanceStraight.h"
+#include "SpeedEstimator.h"
+#include "Odometry.h"
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 走行データを記録するファイル
+  static const char* TELEMETRY_FILE = "telemetry_replay_test.csv";
+
+  // テストで使う動作の組(ライントレース→直進)を実行する
+  static void runMotions()
+  {
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    bool isLeftEdge = true;
+    DistanceLineTracing dl(300.0, 200.0, 45.0, gain, isLeftEdge);
+    DistanceStraight ds(200.0, 200.0);
+    dl.run();
+    ds.run();
+  }
+
+  TEST(TelemetryReplayTest, recordAndReplay)
+  {
+    // 記録
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    srand(0);
+    SpeedEstimator::reset();
+    TelemetryRecorder::clear();
+    TelemetryRecorder::setEnabled(true);
+    runMotions();
+    TelemetryRecorder::setEnabled(false);
+    int recordedCount = TelemetryRecorder::getSampleCount();
+    TelemetryRecorder::outputToFile(TELEMETRY_FILE);
+    TelemetryRecorder::clear();
+    ASSERT_LT(0, recordedCount);
+
+    // 再生
+    ASSERT_TRUE(TelemetryReplay::load(TELEMETRY_FILE));
+    EXPECT_EQ(recordedCount, TelemetryReplay::getSampleCount());
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    runMotions();
+
+    // 記録した周期をすべて再生し、ほぼすべての周期で記録と同じPWM値が指令されている
+    // (周期内の時刻は記録しないため、経過時間が極端に短い動作開始直後の周期は一致しないことがある)
+    bool isFinished = TelemetryReplay::isFinished();
+    int comparisonCount = TelemetryReplay::getPwmComparisonCount();
+    int mismatchCount = TelemetryReplay::getPwmMismatchCount();
+    TelemetryReplay::unload();
+    remove(TELEMETRY_FILE);
+
+    EXPECT_TRUE(isFinished);
+    EXPECT_LT(0, comparisonCount);
+    EXPECT_GT(comparisonCount * 0.05, mismatchCount);
+  }
+
+  // 動作ごとにモータ角位置を初期化しながら(AreaMasterと同様に)動作の組を実行する
+  static void runMotionsWithReset()
+  {
+    PidGain gain = { 0.1, 0.05, 0.05 };
+    bool isLeftEdge = true;
+    DistanceLineTracing dl(300.0, 200.0, 45.0, gain, isLeftEdge);
+    DistanceStraight ds(200.0, 200.0);
+    Motion* motions[] = { &dl, &ds };
+    for(Motion* motion : motions) {
+      Measurer::resetCount();
+      Odometry::update();
+      motion->run();
+    }
+    Odometry::update();
+  }
+
+  TEST(TelemetryReplayTest, replayTotalCountWithReset)
+  {
+    // 記録
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    srand(0);
+    SpeedEstimator::reset();
+    Odometry::reset();
+    int initRightTotalCount = Measurer::getRightTotalCount();
+    int initLeftTotalCount = Measurer::getLeftTotalCount();
+    TelemetryRecorder::clear();
+    TelemetryRecorder::setEnabled(true);
+    runMotionsWithReset();
+    TelemetryRecorder::setEnabled(false);
+    int recordedRightDiff = Measurer::getRightTotalCount() - initRightTotalCount;
+    int recordedLeftDiff = Measurer::getLeftTotalCount() - initLeftTotalCount;
+    Pose recordedPose = Odometry::getPose();
+    TelemetryRecorder::outputToFile(TELEMETRY_FILE);
+    TelemetryRecorder::clear();
+
+    // 再生
+    ASSERT_TRUE(TelemetryReplay::load(TELEMETRY_FILE));
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    SpeedEstimator::reset();
+    Odometry::reset();
+    initRightTotalCount = Measurer::getRightTotalCount();
+    initLeftTotalCount = Measurer::getLeftTotalCount();
+    runMotionsWithReset();
+    int replayedRightDiff = Measurer::getRightTotalCount() - initRightTotalCount;
+    int replayedLeftDiff = Measurer::getLeftTotalCount() - initLeftTotalCount;
+    Pose replayedPose = Odometry::getPose();
+    bool isFinished = TelemetryReplay::isFinished();
+    TelemetryReplay::unload();
+    remove(TELEMETRY_FILE);
+
+    // 動作の間の初期化をまたいでも、起動時からの角位置と走行体の位置が記録と一致する
+    EXPECT_TRUE(isFinished);
+    EXPECT_EQ(recordedRightDiff, replayedRightDiff);
+    EXPECT_EQ(recordedLeftDiff, replayedLeftDiff);
+    EXPECT_DOUBLE_EQ(recordedPose.x, replayedPose.x);
+    EXPECT_DOUBLE_EQ(recordedPose.y, replayedPose.y);
+    EXPECT_DOUBLE_EQ(recordedPose.theta, replayedPose.theta);
+  }
+
+  TEST(TelemetryReplayTest, finishMotionOnce)
+  {
+    // 動作の終了判定時の記録が連続する(次の動作が1周期も回らずに終わった)走行データ
+    FILE* fp = fopen(TELEMETRY_FILE, "w");
+    ASSERT_NE(nullptr, fp);
+    fprintf(fp, "time,r,g,b,rightCount,leftCount,rightTotalCount,leftTotalCount,rightPwm,"
+                "leftPwm,isFinal\n");
+    fprintf(fp, "10000,0,0,0,10,10,10,10,0,0,1\n");
+    fprintf(fp, "20000,0,0,0,0,0,10,10,0,0,1\n");
+    fprintf(fp, "30000,0,0,0,5,5,15,15,50,50,0\n");
+    fclose(fp);
+    ASSERT_TRUE(TelemetryReplay::load(TELEMETRY_FILE));
+
+    // 左右のモータを止めても、1つの動作の終了として1周期だけ進む
+    Controller::stopMotor();
+    int index = TelemetryReplay::getIndex();
+    Controller::stopMotor();
+    int nextIndex = TelemetryReplay::getIndex();
+    TelemetryReplay::unload();
+    remove(TELEMETRY_FILE);
+
+    EXPECT_EQ(1, index);
+    EXPECT_EQ(2, nextIndex);
+  }
+
+  TEST(TelemetryReplayTest, recordDisabled)
+  {
+    TelemetryRecorder::clear();
+    TelemetryRecorder::setEnabled(false);
+    TelemetryRecorder::record();
+    EXPECT_EQ(0, TelemetryRecorder::getSampleCount());
+  }
+
+  TEST(TelemetryReplayTest, loadMissingFile)
+  {
+    EXPECT_FALSE(TelemetryReplay::load("not_exist_telemetry.csv"));
+    EXPECT_FALSE(TelemetryReplay::isReplaying());
+  }
+}  // namespace etrobocon2023_test
@@ -24,10 +24,70 @@ namespace etrobocon2023_test {
   {
     Timer timer;
     int sleepTime = 50;
+    // ダミーのクロックは呼び出すたびに1マイクロ秒進むので、ミリ秒の切り替わりにそろえる
+    while(timer.nowMicro() % 1000 != 0) {
+    }
     int initTime = timer.now();
     timer.sleep(sleepTime);
     int actualTime = timer.now();
     int expectedTime = initTime + sleepTime;
     EXPECT_EQ(expectedTime, actualTime);
   }
+
+  TEST(TimerTest, nowMicro)
+  {
+    Timer timer;
+    uint64_t initTime = timer.nowMicro();
+    timer.sleep(10);
+    uint64_t actualTime = timer.nowMicro();
+    // ダミーのクロックはnow()の呼び出しごとに1マイクロ秒進む
+    EXPECT_EQ(initTime + 10000 + 1, actualTime);
+    EXPECT_EQ((actualTime + 1) * 1000, timer.nowNano());
+  }
+
+  TEST(TimerTest, elapsedMicro)
+  {
+    Timer timer;
+    uint64_t startTime = timer.nowMicro();
+    timer.sleep(20);
+    uint64_t elapsedTime = timer.elapsedMicro(startTime);
+    EXPECT_LE(20000u, elapsedTime);
+    EXPECT_GT(20010u, elapsedTime);
+    // 未来の時刻を指定した場合は0
+    EXPECT_EQ(0u, timer.elapsedMicro(timer.nowMicro() + 1000000));
+  }
+
+  TEST(TimerTest, sleepUntil)
+  {
+    Timer timer;
+    uint64_t targetTime = timer.nowMicro() + 5000;
+    timer.sleepUntil(targetTime);
+    uint64_t actualTime = timer.nowMicro();
+    EXPECT_LE(targetTime, actualTime);
+    EXPECT_GT(targetTime + 10, actualTime);
+  }
+
+  TEST(TimerTest, sleepUntilPastTime)
+  {
+    Timer timer;
+    uint64_t targetTime = timer.nowMicro();
+    timer.sleep(10);
+    uint64_t initTime = timer.nowMicro();
+    // 指定時刻を過ぎている場合はスリープしない
+    timer.sleepUntil(targetTime);
+    EXPECT_GT(initTime + 10, timer.nowMicro());
+  }
+
+  TEST(TimerTest, nowAfterLongRun)
+  {
+    Timer timer;
+    // int型の範囲を超えるマイクロ秒(約36分)が経過しても、ミリ秒は正しく求まる
+    for(int i = 0; i < 3; i++) {
+      timer.sleep(1000000);
+    }
+    uint64_t microTime = timer.nowMicro();
+    int milliTime = timer.now();
+    EXPECT_LT(2147483647u, microTime);
+    EXPECT_EQ(static_cast<int>((microTime + 1) / 1000), milliTime);
+  }
 }  // namespace etrobocon2023_test
\ No newline at end of file
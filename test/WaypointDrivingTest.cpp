@@ -0,0 +1,79 @@
+/**
+ * @file   WaypointDrivingTest.cpp
+ * @brief  WaypointDrivingクラスのテスト
+ * @author KatLab
+ */
+
+#include "WaypointDriving.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace etrobocon2023_test {
+  // 斜め前方の座標まで走行するテスト
+  TEST(WaypointDrivingTest, run)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    double targetX = 300.0;
+    double targetY = 300.0;
+    WaypointDriving wp(targetX, targetY, 200.0, 60.0);
+
+    wp.run();
+
+    // 目標座標の近くに到達する
+    Pose pose = Odometry::getPose();
+    EXPECT_NEAR(targetX, pose.x, 30.0);
+    EXPECT_NEAR(targetY, pose.y, 30.0);
+  }
+
+  // 後方の座標まで走行するテスト
+  TEST(WaypointDrivingTest, runBackward)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    double targetX = -200.0;
+    double targetY = -100.0;
+    WaypointDriving wp(targetX, targetY, 200.0, 60.0);
+
+    wp.run();
+
+    Pose pose = Odometry::getPose();
+    EXPECT_NEAR(targetX, pose.x, 30.0);
+    EXPECT_NEAR(targetY, pose.y, 30.0);
+  }
+
+  // すでに目標座標にいる場合は走行しないテスト
+  TEST(WaypointDrivingTest, runAlreadyArrived)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    int initialRightCount = Measurer::getRightCount();
+    int initialLeftCount = Measurer::getLeftCount();
+    WaypointDriving wp(1.0, -1.0, 200.0, 60.0);
+
+    wp.run();
+
+    EXPECT_EQ(initialRightCount, Measurer::getRightCount());
+    EXPECT_EQ(initialLeftCount, Measurer::getLeftCount());
+  }
+
+  // 目標速度が0以下の場合はwarningを出して走行しないテスト
+  TEST(WaypointDrivingTest, runZeroSpeed)
+  {
+    Controller::setRightMotorPwm(0.0);
+    Controller::setLeftMotorPwm(0.0);
+    Odometry::reset();
+    WaypointDriving wp(300.0, 0.0, 0.0, 60.0);
+
+    testing::internal::CaptureStdout();
+    wp.run();
+    string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(string::npos, output.find("Warning"));
+    EXPECT_NEAR(0.0, Odometry::getPose().x, 0.001);
+  }
+}  // namespace etrobocon2023_test
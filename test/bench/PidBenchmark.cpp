@@ -0,0 +1,97 @@
+/**
+ * @file   PidBenchmark.cpp
+ * @brief  doubleと固定小数点数(Q16_16)で計算するPIDの計算時間を比べるベンチマーク
+ * @author KatLab
+ * @note   単体テストとは別のターゲット(etrobocon2023_bench)で、最適化を有効にしてビルドする。
+ *         USE_FIXED_POINT_CONTROLを有効にするかは、EV3向けにビルドしたこの結果で判断する
+ */
+
+#include "FixedPoint.h"
+#include "Pid.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <math.h>
+
+using namespace std;
+
+namespace {
+  constexpr int INPUT_COUNT = 1000;  // 入力の輝度の数(ライントレースの10秒分)
+  constexpr int ITERATIONS = 200;    // 1回の計測で入力を繰り返す回数
+  constexpr int REPEAT = 9;          // 計測の回数(中央値を使う)
+
+  /**
+   * @brief 1回の計測で、入力をすべてPIDに通す時間を計る
+   * @param pid 計測するPID
+   * @param inputs 入力の輝度
+   * @param outputs PIDの操作量を格納する配列
+   * @return 1回のcalculatePidあたりの計算時間[ns]
+   */
+  template <typename T>
+  double measure(BasicPid<T>& pid, const T* inputs, double* outputs)
+  {
+    const T delta(0.01);  // 制御周期[s]
+    auto start = chrono::steady_clock::now();
+    for(int n = 0; n < ITERATIONS; n++) {
+      for(int i = 0; i < INPUT_COUNT; i++) {
+        outputs[i] = static_cast<double>(pid.calculatePid(inputs[i], delta));
+      }
+    }
+    auto elapsed = chrono::steady_clock::now() - start;
+    long long ns = chrono::duration_cast<chrono::nanoseconds>(elapsed).count();
+    return static_cast<double>(ns) / (static_cast<double>(ITERATIONS) * INPUT_COUNT);
+  }
+
+  /**
+   * @brief REPEAT回計測し、計算時間の中央値を求める
+   * @param pid 計測するPID
+   * @param inputs 入力の輝度
+   * @param outputs 最後の計測でのPIDの操作量を格納する配列
+   * @return 1回のcalculatePidあたりの計算時間の中央値[ns]
+   */
+  template <typename T>
+  double measureMedian(BasicPid<T>& pid, const T* inputs, double* outputs)
+  {
+    double times[REPEAT];
+    for(int r = 0; r < REPEAT; r++) {
+      times[r] = measure(pid, inputs, outputs);
+    }
+    sort(times, times + REPEAT);
+    return times[REPEAT / 2];
+  }
+}  // namespace
+
+int main()
+{
+  // ライントレース中の輝度を模した入力(目標輝度45の周りを揺れる)
+  static double doubleInputs[INPUT_COUNT];
+  static Q16_16 fixedInputs[INPUT_COUNT];
+  for(int i = 0; i < INPUT_COUNT; i++) {
+    doubleInputs[i] = 45.0 + 20.0 * sin(i * 0.05) + 5.0 * sin(i * 0.7);
+    fixedInputs[i] = Q16_16(doubleInputs[i]);
+  }
+
+  // LineTracingの旋回値と同じ設定のPID
+  Pid doublePid(0.09, 0.08, 0.05, 45, 0.0, 0.001);
+  FixedPointPid fixedPid(0.09, 0.08, 0.05, 45, 0.0, 0.001);
+  doublePid.setOutputLimit(-100, 100);
+  fixedPid.setOutputLimit(-100, 100);
+
+  static double doubleOutputs[INPUT_COUNT];
+  static double fixedOutputs[INPUT_COUNT];
+  double doubleNs = measureMedian(doublePid, doubleInputs, doubleOutputs);
+  double fixedNs = measureMedian(fixedPid, fixedInputs, fixedOutputs);
+
+  // 同じ入力に対する操作量の差(計算時間だけでなく結果も比べる)
+  double maxError = 0.0;
+  for(int i = 0; i < INPUT_COUNT; i++) {
+    maxError = max(maxError, fabs(doubleOutputs[i] - fixedOutputs[i]));
+  }
+
+  printf("Pid<double> : %8.1f ns/call\n", doubleNs);
+  printf("Pid<Q16_16> : %8.1f ns/call\n", fixedNs);
+  printf("Q16_16 / double: %.2f (%s is faster)\n", fixedNs / doubleNs,
+         fixedNs < doubleNs ? "Q16_16" : "double");
+  printf("max |output difference|: %.4f\n", maxError);
+  return 0;
+}
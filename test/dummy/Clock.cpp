@@ -5,6 +5,7 @@
  */
 
 #include "Clock.h"
+#include "TelemetryReplay.h"
 using namespace ev3api;
 
 Clock::Clock()
@@ -14,11 +15,18 @@ Clock::Clock()
 
 void Clock::sleep(int duration)
 {
+  // 再生中は1回のスリープを1周期として記録を進める
+  if(TelemetryReplay::isReplaying()) {
+    TelemetryReplay::advance();
+    return;
+  }
   microTime += static_cast<uint64_t>(duration);
 }
 
 uint64_t Clock::now()
 {
+  // 再生中は記録時刻を返す
+  if(TelemetryReplay::isReplaying()) return TelemetryReplay::getTime();
   microTime = microTime + static_cast<uint64_t>(1);
   return microTime;
 }
@@ -5,6 +5,7 @@
  */
 
 #include "ColorSensor.h"
+#include "TelemetryReplay.h"
 using namespace ev3api;
 
 // コンストラクタ
@@ -13,6 +14,12 @@ ColorSensor::ColorSensor(ePortS port) {}
 // RGB値を取得
 void ColorSensor::getRawColor(rgb_raw_t& rgb)
 {
+  // 再生中は記録されたRGB値を返す
+  if(TelemetryReplay::isReplaying()) {
+    rgb = TelemetryReplay::getRawColor();
+    return;
+  }
+
   int index = rand() % 6;
   switch(index) {
     case 0:
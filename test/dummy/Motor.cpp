@@ -5,10 +5,11 @@
  */
 
 #include "Motor.h"
+#include "TelemetryReplay.h"
 using namespace ev3api;
 
 // コンストラクタ
-Motor::Motor(ePortM _port, bool brake, motor_type_t type)
+Motor::Motor(ePortM _port, bool brake, motor_type_t type) : port(_port)
 {
   motorCount = 0;
 }
@@ -18,9 +19,22 @@ Motor::Motor(ePortM _port, bool brake, motor_type_t type)
 // モータ角位置取得
 int Motor::getCount()
 {
+  // 再生中は記録されたモータ角位置を返す
+  if(TelemetryReplay::isReplaying() && port != PORT_A) return TelemetryReplay::getCount(port);
   return static_cast<int>(motorCount);
 }
 
+// モータ角位置更新
+void Motor::setCount(int count)
+{
+  // 再生中は記録された起動時からの角位置に対する基準を更新する
+  if(TelemetryReplay::isReplaying() && port != PORT_A) {
+    TelemetryReplay::setCount(port, count);
+    return;
+  }
+  motorCount = count;
+}
+
 // pwm値設定
 void Motor::setPWM(int pwm)
 {
@@ -31,9 +45,23 @@ void Motor::setPWM(int pwm)
     _pwm = -100;
   }
 
+  // 再生中は記録されたPWM値と比較する(角位置は記録に従う)
+  if(TelemetryReplay::isReplaying() && port != PORT_A) {
+    TelemetryReplay::comparePwm(port, _pwm);
+    return;
+  }
+
   motorCount += static_cast<double>(_pwm) * 0.05;
 }
 
+// 停止する
+void Motor::stop()
+{
+  // 再生中は動作の終了として次の動作の周期に進める
+  // (Controller::stopMotor()は左右を止めるため、動作ごとに1回だけ進めるよう右モータでだけ進める)
+  if(TelemetryReplay::isReplaying() && port == PORT_B) TelemetryReplay::finishMotion();
+}
+
 // motorCountのリセット
 void Motor::reset()
 {
@@ -33,7 +33,7 @@ namespace ev3api {
     /**
      * モータ角位置更新
      */
-    void setCount(int count){};
+    void setCount(int count);
 
     /**
      * pwm値設定
@@ -44,7 +44,7 @@ namespace ev3api {
     /**
      * 停止する
      */
-    void stop(){};
+    void stop();
 
     /**
      * モータカウントを初期化する
@@ -52,6 +52,7 @@ namespace ev3api {
     void reset();
 
    private:
+    ePortM port;
     double motorCount;
   };
 }  // namespace ev3api
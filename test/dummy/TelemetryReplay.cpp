@@ -0,0 +1,179 @@
+/**
+ * @file TelemetryReplay.cpp
+ * @brief 記録した走行データをダミーのセンサ・モータに再生するクラス（ダミー）
+ * @author KatLab
+ */
+
+#include "TelemetryReplay.h"
+
+std::vector<TelemetryReplay::Sample> TelemetryReplay::samples;
+bool TelemetryReplay::isLoaded = false;
+int TelemetryReplay::index = 0;
+int TelemetryReplay::rightCountBase = 0;
+int TelemetryReplay::leftCountBase = 0;
+int TelemetryReplay::comparisonCount = 0;
+int TelemetryReplay::mismatchCount = 0;
+int TelemetryReplay::maxDiff = 0;
+long long TelemetryReplay::sumDiff = 0;
+
+bool TelemetryReplay::load(const char* filePath)
+{
+  unload();
+
+  FILE* fp = fopen(filePath, "r");
+  if(fp == NULL) return false;
+
+  const int BUF_SIZE = 256;
+  char row[BUF_SIZE];
+  // ヘッダ行を読み飛ばす
+  if(fgets(row, BUF_SIZE, fp) == NULL) {
+    fclose(fp);
+    return false;
+  }
+
+  while(fgets(row, BUF_SIZE, fp) != NULL) {
+    unsigned long long time;
+    double rightPwm;
+    double leftPwm;
+    int isFinal;
+    Sample sample;
+    int n = sscanf(row, "%llu,%d,%d,%d,%d,%d,%d,%d,%lf,%lf,%d", &time, &sample.rgb.r,
+                   &sample.rgb.g, &sample.rgb.b, &sample.rightCount, &sample.leftCount,
+                   &sample.rightTotalCount, &sample.leftTotalCount, &rightPwm, &leftPwm, &isFinal);
+    if(n != 11) continue;  // 不正な行は読み飛ばす
+    sample.time = static_cast<uint64_t>(time);
+    sample.isFinal = isFinal != 0;
+    sample.rightPwm = toMotorPwm(rightPwm);
+    sample.leftPwm = toMotorPwm(leftPwm);
+    samples.push_back(sample);
+  }
+  fclose(fp);
+
+  isLoaded = !samples.empty();
+  if(isLoaded) {
+    // 記録開始時のモータ角位置が再生されるよう基準を合わせる
+    rightCountBase = samples[0].rightTotalCount - samples[0].rightCount;
+    leftCountBase = samples[0].leftTotalCount - samples[0].leftCount;
+  }
+  return isLoaded;
+}
+
+void TelemetryReplay::unload()
+{
+  samples.clear();
+  isLoaded = false;
+  index = 0;
+  rightCountBase = 0;
+  leftCountBase = 0;
+  comparisonCount = 0;
+  mismatchCount = 0;
+  maxDiff = 0;
+  sumDiff = 0;
+}
+
+bool TelemetryReplay::isReplaying()
+{
+  return isLoaded;
+}
+
+void TelemetryReplay::advance()
+{
+  if(!isLoaded) return;
+  // 末尾に到達した後は最後の周期を保持する
+  if(index < static_cast<int>(samples.size()) - 1) index++;
+}
+
+void TelemetryReplay::finishMotion()
+{
+  if(!isLoaded) return;
+  // 終了判定時の記録を再生し終えたときだけ、次の動作の周期に進める
+  if(samples[index].isFinal) advance();
+}
+
+bool TelemetryReplay::isFinished()
+{
+  return isLoaded && index >= static_cast<int>(samples.size()) - 1;
+}
+
+int TelemetryReplay::getIndex()
+{
+  return index;
+}
+
+int TelemetryReplay::getSampleCount()
+{
+  return static_cast<int>(samples.size());
+}
+
+uint64_t TelemetryReplay::getTime()
+{
+  return samples[index].time;
+}
+
+rgb_raw_t TelemetryReplay::getRawColor()
+{
+  return samples[index].rgb;
+}
+
+int TelemetryReplay::getCount(ePortM port)
+{
+  // PORT_B:右モータ, PORT_C:左モータ
+  if(port == PORT_B) return samples[index].rightTotalCount - rightCountBase;
+  if(port == PORT_C) return samples[index].leftTotalCount - leftCountBase;
+  return 0;
+}
+
+void TelemetryReplay::setCount(ePortM port, int count)
+{
+  // 実機と同様に、再生中の周期の角位置を基準に付け替える
+  if(port == PORT_B) rightCountBase = samples[index].rightTotalCount - count;
+  if(port == PORT_C) leftCountBase = samples[index].leftTotalCount - count;
+}
+
+void TelemetryReplay::comparePwm(ePortM port, int pwm)
+{
+  int expected;
+  if(port == PORT_B) {
+    expected = samples[index].rightPwm;
+  } else if(port == PORT_C) {
+    expected = samples[index].leftPwm;
+  } else {
+    return;  // アームモータは記録していない
+  }
+
+  int diff = pwm > expected ? pwm - expected : expected - pwm;
+  comparisonCount++;
+  sumDiff += diff;
+  if(diff != 0) mismatchCount++;
+  if(diff > maxDiff) maxDiff = diff;
+}
+
+int TelemetryReplay::getPwmComparisonCount()
+{
+  return comparisonCount;
+}
+
+int TelemetryReplay::getPwmMismatchCount()
+{
+  return mismatchCount;
+}
+
+int TelemetryReplay::getMaxPwmDiff()
+{
+  return maxDiff;
+}
+
+double TelemetryReplay::getMeanPwmDiff()
+{
+  if(comparisonCount == 0) return 0.0;
+  return static_cast<double>(sumDiff) / comparisonCount;
+}
+
+int TelemetryReplay::toMotorPwm(double pwm)
+{
+  // Controllerと同様に整数化してから-100~100に制限する
+  int value = static_cast<int>(pwm);
+  if(value > 100) return 100;
+  if(value < -100) return -100;
+  return value;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file TelemetryReplay.h
+ * @brief 記録した走行データをダミーのセンサ・モータに再生するクラス（ダミー）
+ * @author KatLab
+ */
+
+#ifndef TELEMETRY_REPLAY_H
+#define TELEMETRY_REPLAY_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include "Port.h"
+#include "ColorSensor.h"
+
+class TelemetryReplay {
+ public:
+  TelemetryReplay() = delete;  // 明示的にインスタンス化を禁止
+
+  /**
+   * @brief 走行データ(TelemetryRecorderが出力したCSV)を読み込み、再生を開始する
+   * @param filePath 走行データのファイルパス
+   * @return true:読み込み成功, false:読み込み失敗
+   */
+  static bool load(const char* filePath);
+
+  /**
+   * @brief 再生を終了し、ダミーを通常動作（乱数）に戻す
+   */
+  static void unload();
+
+  /**
+   * @brief 再生中かどうかを取得する
+   * @return true:再生中, false:通常動作
+   */
+  static bool isReplaying();
+
+  /**
+   * @brief 次の周期の記録に進める
+   * @note Clock::sleep()から呼び出される
+   */
+  static void advance();
+
+  /**
+   * @brief 動作の終了判定時の記録を再生し終えていれば、次の動作の周期に進める
+   * @note 左右のモータを止めるたびに二重に進めないよう、右モータのMotor::stop()からだけ呼び出される
+   */
+  static void finishMotion();
+
+  /**
+   * @brief 記録の末尾まで再生したかどうかを取得する
+   * @return true:末尾まで再生した, false:再生中
+   */
+  static bool isFinished();
+
+  /**
+   * @brief 再生中の周期番号を取得する
+   * @return 再生中の周期番号(0~)
+   */
+  static int getIndex();
+
+  /**
+   * @brief 読み込んだ周期数を取得する
+   * @return 読み込んだ周期数
+   */
+  static int getSampleCount();
+
+  /**
+   * @brief 再生中の周期の記録時刻を取得する
+   * @return 記録時刻[us]
+   */
+  static uint64_t getTime();
+
+  /**
+   * @brief 再生中の周期のRGB値を取得する
+   * @return RGB値
+   */
+  static rgb_raw_t getRawColor();
+
+  /**
+   * @brief 再生中の周期のモータ角位置を取得する
+   * @param port モータポート番号(PORT_B:右モータ, PORT_C:左モータ)
+   * @return モータ角位置[deg](記録された起動時からの角位置の、setCount()で更新した基準からの差)
+   */
+  static int getCount(ePortM port);
+
+  /**
+   * @brief 再生中のモータ角位置を更新する
+   * @param port モータポート番号(PORT_B:右モータ, PORT_C:左モータ)
+   * @param count 更新後のモータ角位置[deg]
+   * @note 再生中の周期でgetCount()がcountとなるよう基準を更新する(起動時からの角位置は変わらない)
+   */
+  static void setCount(ePortM port, int count);
+
+  /**
+   * @brief 指令されたPWM値を記録されたPWM値と比較する
+   * @param port モータポート番号(PORT_B:右モータ, PORT_C:左モータ)
+   * @param pwm 指令されたPWM値
+   */
+  static void comparePwm(ePortM port, int pwm);
+
+  /**
+   * @brief PWM値を比較した回数を取得する
+   * @return 比較回数
+   */
+  static int getPwmComparisonCount();
+
+  /**
+   * @brief 記録と異なるPWM値が指令された回数を取得する
+   * @return 不一致回数
+   */
+  static int getPwmMismatchCount();
+
+  /**
+   * @brief 指令PWM値と記録PWM値の差の最大値を取得する
+   * @return 差の絶対値の最大値
+   */
+  static int getMaxPwmDiff();
+
+  /**
+   * @brief 指令PWM値と記録PWM値の差の平均値を取得する
+   * @return 差の絶対値の平均値
+   */
+  static double getMeanPwmDiff();
+
+ private:
+  // 1周期分の記録
+  struct Sample {
+    uint64_t time;
+    rgb_raw_t rgb;
+    int rightCount;
+    int leftCount;
+    int rightTotalCount;
+    int leftTotalCount;
+    int rightPwm;
+    int leftPwm;
+    bool isFinal;
+  };
+
+  static std::vector<Sample> samples;
+  static bool isLoaded;
+  static int index;
+  static int rightCountBase;  // 右モータ角位置の基準とする起動時からの角位置[deg]
+  static int leftCountBase;   // 左モータ角位置の基準とする起動時からの角位置[deg]
+  static int comparisonCount;
+  static int mismatchCount;
+  static int maxDiff;
+  static long long sumDiff;
+
+  /**
+   * @brief 記録されたPWM値をモータに設定される値に変換する
+   * @param pwm 記録されたPWM値
+   * @return モータに設定されるPWM値
+   */
+  static int toMotorPwm(double pwm);
+};
+
+#endif
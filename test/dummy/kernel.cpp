@@ -0,0 +1,27 @@
+/**
+ * @file kernel.cpp
+ * @brief TOPPERSカーネルのサービスコールのダミー
+ * @author KatLab
+ */
+
+#include "kernel.h"
+
+ER sta_cyc(ID cycid)
+{
+  return E_OK;
+}
+
+ER stp_cyc(ID cycid)
+{
+  return E_OK;
+}
+
+ER loc_cpu()
+{
+  return E_OK;
+}
+
+ER unl_cpu()
+{
+  return E_OK;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file kernel.h
+ * @brief TOPPERSカーネルのサービスコールのダミー
+ * @author KatLab
+ */
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+typedef int ER;  // エラーコード
+typedef int ID;  // オブジェクトのID番号
+
+#define E_OK 0  // 正常終了
+
+/**
+ * @brief 周期通知の動作を開始する(何もしない)
+ * @param cycid 周期通知のID番号
+ * @return E_OK
+ */
+ER sta_cyc(ID cycid);
+
+/**
+ * @brief 周期通知の動作を停止する(何もしない)
+ * @param cycid 周期通知のID番号
+ * @return E_OK
+ */
+ER stp_cyc(ID cycid);
+
+/**
+ * @brief CPUロック状態へ遷移する(タスクが1つしかないので何もしない)
+ * @return E_OK
+ */
+ER loc_cpu();
+
+/**
+ * @brief CPUロック状態を解除する(タスクが1つしかないので何もしない)
+ * @return E_OK
+ */
+ER unl_cpu();
+
+#endif
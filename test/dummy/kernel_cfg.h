@@ -0,0 +1,12 @@
+/**
+ * @file kernel_cfg.h
+ * @brief コンフィギュレータがapp.cfgから生成するオブジェクトのID番号のダミー
+ * @author KatLab
+ */
+
+#ifndef KERNEL_CFG_H
+#define KERNEL_CFG_H
+
+#define SONAR_CYC 1  // 超音波センサの計測タスクを起動する周期通知
+
+#endif